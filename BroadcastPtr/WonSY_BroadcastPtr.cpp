@@ -6,8 +6,11 @@
 
 #include "WonSY_BroadcastPtr.h"
 
+#include <algorithm>
 #include <map>
 #include <iostream>
+#include <thread>
+#include <unordered_map>
 
 namespace WonSY::Concurrency
 {
@@ -216,6 +219,418 @@ namespace WonSY::Concurrency
 			}
 		}
 
+		// LAZY  ׽Ʈ
+		{
+			std::cout << "start! LAZY  ׽Ʈ " << std::endl;
+
+			using _DataType = std::map< int, std::string >;
+			WsyBroadcastPtr< TestContextKey, _DataType > broadCastPtr( nullptr );
+			const int loopCount = 1000;
+
+			std::atomic< bool > isWriteEnd = false;
+			std::thread writeThread = static_cast< std::thread >( [ & ]()
+				{
+					TestContextKey testContextKey;
+
+					//  Tick    ʴ Ͷ, Set   ʰ Stale ǥø Ѵ.
+					broadCastPtr.SetPublishType( testContextKey, BROADCAST_PUBLISH_TYPE::LAZY );
+
+					for ( int i = 0; i < loopCount; ++i )
+					{
+						broadCastPtr.Set( testContextKey,
+							[ & ]( _DataType& data )
+							{
+								return data.insert( { i, std::to_string( i ) } ).second;
+							} );
+
+						// Tick   Safe Point, ʿϴٸ Master  Slave ֽ   ִ.
+						if ( i % 100 == 99 )
+							broadCastPtr.Publish( testContextKey );
+					}
+
+					isWriteEnd = true;
+				} );
+
+			std::thread readThread = static_cast< std::thread >( [ & ]()
+				{
+					while ( !isWriteEnd )
+					{
+						// Stale̶,  Reader  ûڷμ Master   ¸   Ѵ.
+						broadCastPtr.RunReadOnlyTask(
+							[]( const _DataType& data )
+							{
+								//   key 0 ~ size - 1 ̾ Ѵ.
+								if ( !data.empty() && data.rbegin()->first != static_cast< int >( data.size() ) - 1 )
+									std::cout << "LAZY  Ἲ !" << std::endl;
+							} );
+
+						std::this_thread::sleep_for( 1ms );
+					}
+				} );
+
+			writeThread.join();
+			readThread.join();
+
+			const auto stat = broadCastPtr.GetStat();
+			std::cout << "LAZY  ׽Ʈ ! publish : " << stat.m_publishCount << ", copy : " << stat.m_copyCount << ", skip : " << stat.m_skipCount
+				<< ", last size : " << broadCastPtr.GetCopy().size() << std::endl;
+		}
+
+		// Slave Type ȯ ׽Ʈ
+		{
+			std::cout << "start! Slave Type ȯ ׽Ʈ " << std::endl;
+
+			using _DataType = std::map< int, int >;
+			const int elementCount = 100000;
+			const int loopCount    = 100;
+
+			// Master   std::map, Reader ӵ ޸ FlatMap ޴´.
+			WsyBroadcastPtr< TestContextKey, _DataType >                         mapPtr    ( nullptr );
+			WsyBroadcastPtr< TestContextKey, _DataType, WsyFlatMap< int, int > > flatMapPtr( nullptr );
+
+			const auto chekFunc = [ & ]( auto& broadCastPtr, const std::string& name, const auto& sumFunc )
+			{
+				TestContextKey testContextKey;
+
+				const auto publishStartTime = std::chrono::high_resolution_clock::now();
+				for ( int i = 0; i < loopCount; ++i )
+				{
+					broadCastPtr.Set( testContextKey,
+						[ & ]( _DataType& data )
+						{
+							if ( data.empty() )
+							{
+								for ( int k = 0; k < elementCount; ++k )
+									data.insert( { k, k } );
+							}
+
+							data[ i ] = -i;
+							return true;
+						} );
+				}
+				const auto publishEndTime = std::chrono::high_resolution_clock::now();
+
+				long long sumValue = 0;
+				for ( int i = 0; i < loopCount; ++i )
+					broadCastPtr.RunReadOnlyTask( [ & ]( const auto& data ) { sumValue += sumFunc( data ); } );
+
+				std::cout << name
+					<< " publish : " << std::chrono::duration_cast< std::chrono::milliseconds >( publishEndTime - publishStartTime ).count() << " msecs"
+					<< ", read : " << std::chrono::duration_cast< std::chrono::milliseconds >( std::chrono::high_resolution_clock::now() - publishEndTime ).count() << " msecs"
+					<< ", sum : " << sumValue << std::endl;
+			};
+
+			chekFunc( mapPtr, "map -> map",
+				[]( const _DataType& data )
+				{
+					long long tempValue = 0;
+					for ( const auto& ele : data ) { tempValue += ele.second; }
+					return tempValue;
+				} );
+
+			chekFunc( flatMapPtr, "map -> FlatMap",
+				[]( const WsyFlatMap< int, int >& data )
+				{
+					long long tempValue = 0;
+					for ( const auto value : data.GetValueCont() ) { tempValue += value; }
+					return tempValue;
+				} );
+
+			// ȸ Key 迭   Ž óȴ.
+			flatMapPtr.RunReadOnlyTask(
+				[ & ]( const WsyFlatMap< int, int >& data )
+				{
+					const int* valuePtr = data.Find( 7 );
+					if ( !valuePtr || *valuePtr != -7 || data.Find( elementCount ) )
+						std::cout << "FlatMap ȸ !" << std::endl;
+				} );
+
+			std::cout << "Slave Type ȯ ׽Ʈ ! " << std::endl;
+		}
+
+		// INCREMENTAL  ׽Ʈ
+		{
+			std::cout << "start! INCREMENTAL  ׽Ʈ " << std::endl;
+
+			using _DataType = std::map< int, int >;
+			const int  elementCount        = 1000000;
+			const int  readerCount         = 2;
+			const int  targetCompleteCount = 3;
+			const int  maxStallTickCount   = 5000;                              // = ü  ̸ŭ Tick , Reader  ü   .
+			const auto tickInterval        = std::chrono::milliseconds( 1 );
+			const auto stepBudget          = std::chrono::microseconds( 200 );
+			const auto readHoldTime        = std::chrono::milliseconds( 100 );  // = Reader Slave  ִ ð. Reader ġ Ͽ, Slave Lock Ǯ   Ѵ.
+			const auto stepLimit           = stepBudget * 2;                    // = Step  64 ð Ȯϱ , Budget  ѱ  ִ.
+			const auto worstStepLimit      = readHoldTime / 2;                  // = Step  ٸ Thread CPU ѱ ( Time Slice   ) ϳ, Reader ٷȴٸ readHoldTimeŭ ɸ.
+
+			//  Tick Step ð , percent%  ʴ ð. 幰 CPU ѱ Step ܵȴ.
+			const auto getStepPercentile = []( std::vector< uint64_t > stepNsCont, const std::size_t percent )
+				{
+					std::sort( stepNsCont.begin(), stepNsCont.end() );
+					return stepNsCont.empty() ? std::chrono::nanoseconds( 0 ) : std::chrono::nanoseconds( stepNsCont[ stepNsCont.size() * percent / 100 ] );
+				};
+
+			WsyBroadcastPtr< TestContextKey, _DataType > broadCastPtr(
+				[ & ]()
+				{
+					auto data = new _DataType();
+					for ( int k = 0; k < elementCount; ++k )
+						data->insert( { k, 0 } );
+
+					return data;
+				} );
+
+			// 񱳸 ,   ϴ  ð Ѵ.
+			const auto copyStartTime = std::chrono::high_resolution_clock::now();
+			const auto copyData      = broadCastPtr.GetCopy();
+			const auto copyUs        = std::chrono::duration_cast< std::chrono::microseconds >( std::chrono::high_resolution_clock::now() - copyStartTime ).count();
+
+			IncrementalPublishState state;
+			std::vector< uint64_t > stepNsCont;
+			std::atomic< bool >     isWriteEnd = false;
+			std::atomic< int >      readCount  = 0;
+
+			std::vector< std::thread > readThreadCont;
+			for ( int readerIndex = 0; readerIndex < readerCount; ++readerIndex )
+			{
+				readThreadCont.emplace_back( [ &, readerIndex ]()
+					{
+						// Reader д   Ͽ, ׻  Slave а ֵ Ѵ.
+						std::this_thread::sleep_for( readHoldTime * readerIndex / readerCount );
+
+						while ( !isWriteEnd )
+						{
+							broadCastPtr.RunReadOnlyTask(
+								[ & ]( const _DataType& data )
+								{
+									long long sumValue = 0;
+									for ( const auto& ele : data ) { sumValue += ele.second; }
+
+									if ( sumValue != 0 || static_cast< int >( data.size() ) != elementCount )
+										std::cout << "INCREMENTAL  Ἲ !" << std::endl;
+
+									std::this_thread::sleep_for( readHoldTime );
+								} );
+
+							++readCount;
+						}
+					} );
+			}
+
+			std::thread writeThread = static_cast< std::thread >( [ & ]()
+				{
+					TestContextKey testContextKey;
+					broadCastPtr.SetPublishType( testContextKey, BROADCAST_PUBLISH_TYPE::INCREMENTAL );
+
+					// Reader  б  Ŀ  Ѵ.
+					std::this_thread::sleep_for( readHoldTime );
+
+					uint64_t lastCompleteCount = 0;
+					int      stallTickCount    = 0;
+					for ( int i = 0; state.m_completeCount < targetCompleteCount; ++i )
+					{
+						//   ׻ 0 ǵ .  ִ Slave  Ⱑ ݿȴ.
+						const int key = ( i * 7919 ) % ( elementCount - 1 );
+						broadCastPtr.Set( testContextKey,
+							[ & ]( _DataType& data )
+							{
+								data[ key ]     += 1;
+								data[ key + 1 ] -= 1;
+								return true;
+							} );
+
+						// Tick  ðŭ  Slave .
+						broadCastPtr.PublishStep( testContextKey, { stepBudget, 0 } );
+						state = broadCastPtr.GetIncrementalPublishState( testContextKey );
+						stepNsCont.emplace_back( state.m_lastStepNs );
+
+						// Reader Ӿ  а ִ, ü  Ͼ Ѵ.
+						if ( state.m_completeCount != lastCompleteCount )
+						{
+							lastCompleteCount = state.m_completeCount;
+							stallTickCount    = 0;
+							std::cout << "INCREMENTAL ü : " << state.m_completeCount << ", tick : " << i + 1 << ", read : " << readCount << std::endl;
+						}
+						else if ( ++stallTickCount > maxStallTickCount )
+						{
+							std::cout << "INCREMENTAL  ü ü! complete : " << state.m_completeCount << ", defer : " << state.m_deferCount << std::endl;
+							break;
+						}
+
+						std::this_thread::sleep_for( tickInterval );
+					}
+
+					//  Step Budget  Ѵ.  Slave д Reader  ȿ Reader ð 纸Ѵ.
+					isWriteEnd = true;
+					while ( !broadCastPtr.PublishStep( testContextKey, { stepBudget, 0 } ) )
+						std::this_thread::yield();
+
+					state = broadCastPtr.GetIncrementalPublishState( testContextKey );
+				} );
+
+			writeThread.join();
+			for ( auto& readThread : readThreadCont )
+				readThread.join();
+
+			// Budget ִ Step Reader ٸ ʱ , Reader Slave  д Budget ũ  ʾƾ Ѵ.
+			// Reader CPU  ȿ Step  CPU ѱ , ⼭ p90 , Reader  Ʒ Vector ׽Ʈ p99 .
+			const auto stepP90 = getStepPercentile( stepNsCont, 90 );
+			if ( stepP90 > stepLimit || std::chrono::nanoseconds( state.m_worstStepNs ) > worstStepLimit )
+				std::cout << "INCREMENTAL  Step ð ʰ! p90 : " << stepP90.count() / 1000 << " usecs, worst : " << state.m_worstStepNs / 1000 << " usecs" << std::endl;
+
+			std::cout << "INCREMENTAL  ׽Ʈ ! complete : " << state.m_completeCount << ", restart : " << state.m_restartCount << ", defer : " << state.m_deferCount << ", step : " << state.m_stepCount
+				<< ", over budget step : " << state.m_overBudgetStepCount << ", p90 step : " << stepP90.count() / 1000 << " usecs, worst step : " << state.m_worstStepNs / 1000 << " usecs, full copy : " << copyUs << " usecs, size : " << copyData.size() << std::endl;
+
+			// LAZY Stale ä INCREMENTAL ٲٸ,  Master  Master Lock  Ͼ  Reader Materializeؼ  ȴ.
+			{
+				WsyBroadcastPtr< TestContextKey, _DataType > lazyPtr( []() { return new _DataType{ { 0, 0 } }; } );
+
+				std::atomic< bool > isSwitchEnd = false;
+				std::thread readThread = static_cast< std::thread >( [ & ]()
+					{
+						while ( !isSwitchEnd )
+							lazyPtr.GetCopy();
+					} );
+
+				TestContextKey testContextKey;
+				lazyPtr.SetPublishType( testContextKey, BROADCAST_PUBLISH_TYPE::LAZY );
+				lazyPtr.Set( testContextKey, []( _DataType& data ) { data[ 0 ] = 1; return true; } );
+				lazyPtr.SetPublishType( testContextKey, BROADCAST_PUBLISH_TYPE::INCREMENTAL );
+
+				for ( int i = 0; i < 1000; ++i )
+					lazyPtr.Set( testContextKey, [ i ]( _DataType& data ) { data[ i + 1 ] = i; return true; } );
+
+				isSwitchEnd = true;
+				readThread.join();
+
+				const auto lazyData = lazyPtr.GetCopy();
+				if ( lazyData.size() != 1 || lazyData.at( 0 ) != 1 )
+					std::cout << "LAZY -> INCREMENTAL ȯ !" << std::endl;
+			}
+
+			//  Tick  ū Vector, ٲ  Բ ѱ ó ٽ  ʰ üǾ Ѵ.
+			{
+				using _VectorType = std::vector< int >;
+				const int vectorSize = 4000000;
+
+				// Master ٽ ҴǸ  Vector  Step ٽ ҴǱ , þ ŭ ̸  д.
+				WsyBroadcastPtr< TestContextKey, _VectorType > vectorPtr(
+					[ & ]()
+					{
+						auto data = new _VectorType( vectorSize, 0 );
+						data->reserve( vectorSize + maxStallTickCount );
+						return data;
+					} );
+
+				TestContextKey testContextKey;
+				vectorPtr.SetPublishType( testContextKey, BROADCAST_PUBLISH_TYPE::INCREMENTAL );
+
+				IncrementalPublishState vectorState;
+				std::vector< uint64_t > vectorStepNsCont;
+				for ( int i = 0; vectorState.m_completeCount < targetCompleteCount && i < maxStallTickCount; ++i )
+				{
+					//   ׻ 0 ǵ , 100 Tick ũ⵵ ø.
+					const std::size_t index = ( static_cast< std::size_t >( i ) * 7919 ) % ( vectorSize - 1 );
+					vectorPtr.Set( testContextKey,
+						[ & ]( _VectorType& data )
+						{
+							data[ index ]     += 1;
+							data[ index + 1 ] -= 1;
+							return true;
+						}, { index, index + 2 } );
+
+					if ( i % 100 == 99 )
+					{
+						const std::size_t oldSize = vectorPtr.Get( testContextKey ).size();
+						vectorPtr.Set( testContextKey, []( _VectorType& data ) { data.push_back( 0 ); return true; }, { oldSize, oldSize + 1 } );
+					}
+
+					vectorPtr.PublishStep( testContextKey, { stepBudget, 0 } );
+					vectorState = vectorPtr.GetIncrementalPublishState( testContextKey );
+					vectorStepNsCont.emplace_back( vectorState.m_lastStepNs );
+				}
+
+				vectorPtr.Publish( testContextKey );
+				if ( vectorState.m_completeCount < targetCompleteCount || vectorState.m_restartCount != 0 || vectorPtr.GetCopy() != vectorPtr.Get( testContextKey ) )
+					std::cout << "INCREMENTAL Vector  ݿ ! complete : " << vectorState.m_completeCount << ", restart : " << vectorState.m_restartCount << std::endl;
+
+				//  Vector Ҹ, ٽ   ݿ Budget  ̷ Ѵ.
+				const auto vectorStepP99 = getStepPercentile( vectorStepNsCont, 99 );
+				if ( vectorStepP99 > stepLimit || std::chrono::nanoseconds( vectorState.m_worstStepNs ) > worstStepLimit )
+					std::cout << "INCREMENTAL Vector Step ð ʰ! p99 : " << vectorStepP99.count() / 1000 << " usecs, worst : " << vectorState.m_worstStepNs / 1000 << " usecs" << std::endl;
+			}
+
+			//     Type   ϸ, ̸ State ˷ Ѵ.
+			{
+				using _HashMapType = std::unordered_map< int, int >;
+				WsyBroadcastPtr< TestContextKey, _HashMapType > hashMapPtr( []() { return new _HashMapType{ { 0, 0 } }; } );
+
+				TestContextKey testContextKey;
+				hashMapPtr.SetPublishType( testContextKey, BROADCAST_PUBLISH_TYPE::INCREMENTAL );
+				hashMapPtr.Set( testContextKey, []( _HashMapType& data ) { data[ 1 ] = 1; return true; } );
+				hashMapPtr.PublishStep( testContextKey, { stepBudget, 0 } );
+
+				const auto hashMapState = hashMapPtr.GetIncrementalPublishState( testContextKey );
+				if ( hashMapState.m_isStepSupported || hashMapState.m_fullCopyCount != 1 || hashMapPtr.GetCopy().size() != 2 )
+					std::cout << "INCREMENTAL  Type ǥ !" << std::endl;
+			}
+		}
+
+		// ADAPTIVE  ׽Ʈ
+		{
+			std::cout << "start! ADAPTIVE  ׽Ʈ " << std::endl;
+
+			TestContextKey testContextKey;
+			const int      loopCount = 200;
+
+			// ū Map  ϳ ٲٴ , ü ϴ COPY  ⸦    ϴ DOUBLING ξ δ.
+			{
+				using _DataType = std::map< int, int >;
+				WsyBroadcastPtr< TestContextKey, _DataType > broadCastPtr(
+					[]()
+					{
+						auto data = new _DataType();
+						for ( int k = 0; k < 100000; ++k )
+							data->insert( { k, k } );
+
+						return data;
+					} );
+
+				for ( int i = 0; i < loopCount; ++i )
+					broadCastPtr.Set( testContextKey, [ & ]( _DataType& data ) { data[ i ] = -i; return true; }, BROADCAST_SYNC_TYPE::ADAPTIVE );
+
+				const auto state = broadCastPtr.GetAdaptiveSyncState();
+				if ( state.m_syncType != BROADCAST_SYNC_TYPE::DOUBLING || broadCastPtr.GetCopy() != broadCastPtr.Get( testContextKey ) )
+					std::cout << "ADAPTIVE  ! ū Map DOUBLING̾ " << std::endl;
+			}
+
+			//  Ϳ   ϴ ,     ϴ DOUBLING  ϴ COPY ξ δ.
+			{
+				using _DataType = std::vector< uint64_t >;
+				WsyBroadcastPtr< TestContextKey, _DataType > broadCastPtr( []() { return new _DataType( 1, 0 ); } );
+
+				for ( int i = 0; i < loopCount; ++i )
+				{
+					broadCastPtr.Set( testContextKey,
+						[ & ]( _DataType& data )
+						{
+							uint64_t hashValue = data[ 0 ];
+							for ( int k = 0; k < 100000; ++k )
+								hashValue = hashValue * 6364136223846793005ULL + k;
+
+							data[ 0 ] = hashValue;
+							return true;
+						}, BROADCAST_SYNC_TYPE::ADAPTIVE );
+				}
+
+				const auto state = broadCastPtr.GetAdaptiveSyncState();
+				if ( state.m_syncType != BROADCAST_SYNC_TYPE::COPY || broadCastPtr.GetCopy() != broadCastPtr.Get( testContextKey ) )
+					std::cout << "ADAPTIVE  !   COPY " << std::endl;
+			}
+
+			std::cout << "ADAPTIVE  ׽Ʈ ! " << std::endl;
+		}
+
 		// Ἲ ׽Ʈ
 		{
 			std::cout << "start! Ἲ ׽Ʈ " << std::endl;
@@ -281,6 +696,16 @@ namespace WonSY::Concurrency
 			const int loopCount       = 10000;
 			const int readThreadCount = 3;
 
+			// ADAPTIVE   Ѵ.
+			const auto printAdaptiveFunc = []( const auto& broadCastPtr, const std::string& name )
+			{
+				const auto state = broadCastPtr.GetAdaptiveSyncState();
+				std::cout << name << " : " << ( state.m_syncType == BROADCAST_SYNC_TYPE::COPY ? "COPY" : "DOUBLING" )
+					<< ", copy cost : " << state.m_copyCostNs << " ns, doubling cost : " << state.m_doublingCostNs << " ns"
+					<< ", doubling fallback : " << state.m_doublingFallbackCount << " / " << state.m_doublingCount
+					<< ", switch : " << state.m_switchCount << std::endl;
+			};
+
 			{
 				// string
 				WsyBroadcastPtr< TestContextKey, std::string > broadCastPtr( nullptr );
@@ -343,6 +768,11 @@ namespace WonSY::Concurrency
 				broadCastPtr.Set( TestContextKey(), std::string() );
 
 				chekFunc( broadCastPtr, "String - Copy", BROADCAST_SYNC_TYPE::COPY );
+
+				broadCastPtr.Set( TestContextKey(), std::string() );
+
+				chekFunc( broadCastPtr, "String - ADAPTIVE", BROADCAST_SYNC_TYPE::ADAPTIVE );
+				printAdaptiveFunc( broadCastPtr, "String - ADAPTIVE" );
 			}
 
 			{
@@ -412,6 +842,13 @@ namespace WonSY::Concurrency
 
 				chekFunc( broadCastPtr, "map - Copy", BROADCAST_SYNC_TYPE::COPY );
 
+				broadCastPtr.Set( TestContextKey(), std::map< int, TestUnit >() );
+
+				// ADAPTIVE Writer Slave ݿϴ 븸 Ѵ.   ü ð Reader GetCopy ϴ Map ũ⿡ ¿Ǿ,
+				// Writer  Reader  ū Map ϰ Ǳ , ü ð  쿭 Ǵ  . (  Ȯ ADAPTIVE  ׽Ʈ )
+				chekFunc( broadCastPtr, "map - ADAPTIVE", BROADCAST_SYNC_TYPE::ADAPTIVE );
+				printAdaptiveFunc( broadCastPtr, "map - ADAPTIVE" );
+
 				//    copy  ..
 			}
 		}
@@ -8,8 +8,17 @@
 
 #define WONSY_CONCURRENCY
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
 #include <functional>
+#include <map>
+#include <mutex>
 #include <shared_mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
 
 #define NODISCARD            [[nodiscard]]
 #define DEPRECATED_THREAD_ID true
@@ -30,49 +39,457 @@ namespace WonSY::Concurrency
 	// BroadcastPtr Ver 0.5 : Sub ContextKey ߱ ʰ, ø ̹  Context Key  óϵ 
 	// BroadcastPtr Ver 0.6 : SYNC_TYPE ,  Ȥ  ϵ ó, Context   Get ƴ Copy ϵ Լ 
 	// BroadcastPtr Ver 0.7 : Context Key  ߴ, Const Data Ref ڷ ޴ Read Only Task ,   ó  ִ  ߰
+	// BroadcastPtr Ver 0.8 : PUBLISH_TYPE::LAZY ߰. Set ÿ Slave Stale ǥø ϰ,   Version ִ 1ȸ, Reader  û Ȥ Master Publish  
+	// BroadcastPtr Ver 0.9 : Slave Type Master Type ٸ   ֵ . Publish  _TransformType  Reader ǥ( ex. FlatMap ) ȯ
+	// BroadcastPtr Ver 1.0 : Publish Listener ߰. BroadcastPublisher  Publish Version ٸ Process Replica   
+	// BroadcastPtr Ver 1.1 : SYNC_TYPE::ADAPTIVE ߰. COPY DOUBLING   Ͽ, νϽ     
+	// BroadcastPtr Ver 1.2 : PUBLISH_TYPE::INCREMENTAL ߰. ſ ū ͸ PublishStep  Step ð, ũ     , ϼǸ Slave ü
 
 	enum class SYNC_TYPE
 	{
 		COPY,      // = Master ͸ Slave 
-		DOUBLING,  // = Master  ൿ ϰ Slave 
+		DOUBLING,  // = Master  ൿ ϰ Slave . Լ  Ϳ  ׻    Ѵ. ( ex. ܺ Counter,   Լ   )
+		ADAPTIVE,  // = COPY DOUBLING  ( DOUBLING     ) Ͽ,     
+		           //   ó    Ƚ DOUBLING ϱ , Լ DOUBLING   ؾ Ѵ.   Slave  ߳.
 	};
 
-	template < class _ContextKeyType, class _DataType >
+	enum class PUBLISH_TYPE
+	{
+		EAGER,        // = Set  ٷ Slave ݿ ( ⺻ )
+		LAZY,         // = Set  Version ø, Reader  û( GetCopy, RunReadOnlyTask ) Ȥ Master Publish  
+		INCREMENTAL,  // = Set  ƹ͵  ʰ, Master PublishStep ѵ 縸ŭ  Slave , ϼǸ ü. Reader ׵  Version .
+		              //   ü Slave Lock  ͸ ٲٸ,  Slave ü   Reader   Ŀ  ҸŲ.
+	};
+
+	struct BroadcastStat
+	{
+		uint64_t m_publishCount = 0;  // = Master ߻ Publish( Version ) Ƚ
+		uint64_t m_copyCount    = 0;  // =  Master -> Slave 簡  Ƚ
+		uint64_t m_skipCount    = 0;  // = LAZY 忡,     ä  Version    Ƚ
+	};
+
+	// Reader ȸ ȸ ϴ 찡  , Node  std::map  Key Value  ӵ ޸𸮿   б  Map.
+	// Publish  std::mapκ   ϸ, Key 迭   ֱ  ȸ   Ž Cache( SIMD ) ģȭ̴.
+	template < class _KeyType, class _ValueType >
+	class FlatMap
+	{
+	public:
+		FlatMap() = default;
+
+		explicit FlatMap( const std::map< _KeyType, _ValueType >& sourceMap )
+		{
+			m_keyCont  .reserve( sourceMap.size() );
+			m_valueCont.reserve( sourceMap.size() );
+
+			for ( const auto& [ key, value ] : sourceMap )
+			{
+				m_keyCont  .emplace_back( key   );
+				m_valueCont.emplace_back( value );
+			}
+		}
+
+		NODISCARD const _ValueType* Find( const _KeyType& key ) const
+		{
+			const auto keyIter = std::lower_bound( m_keyCont.begin(), m_keyCont.end(), key );
+			if ( keyIter == m_keyCont.end() || key < *keyIter )
+				return nullptr;
+
+			return &m_valueCont[ keyIter - m_keyCont.begin() ];
+		}
+
+		NODISCARD std::size_t size()  const { return m_keyCont.size();  }
+		NODISCARD bool        empty() const { return m_keyCont.empty(); }
+
+		NODISCARD const std::vector< _KeyType   >& GetKeyCont()   const { return m_keyCont;   }
+		NODISCARD const std::vector< _ValueType >& GetValueCont() const { return m_valueCont; }
+
+	private:
+		std::vector< _KeyType   > m_keyCont;
+		std::vector< _ValueType > m_valueCont;
+	};
+
+	// SYNC_TYPE::ADAPTIVE  ð  ٰ. GetAdaptiveSyncState ȸѴ.
+	struct AdaptiveSyncState
+	{
+		SYNC_TYPE m_syncType              = SYNC_TYPE::COPY;  // =  õ  ( COPY or DOUBLING )
+		uint64_t  m_copyCostNs            = 0;                // = COPY 1ȸ  ̵ , 0̸   
+		uint64_t  m_doublingCostNs        = 0;                // = DOUBLING 1ȸ  ̵ , 0̸   
+		uint64_t  m_doublingCount         = 0;
+		uint64_t  m_doublingFallbackCount = 0;                // = DOUBLING Ͽ COPY Ƚ
+		uint64_t  m_switchCount           = 0;                // =  ٲ Ƚ
+	};
+
+	// PublishStep   ϴ . 0̸  ʴ´.
+	struct IncrementalPublishBudget
+	{
+		std::chrono::nanoseconds m_timeBudget = std::chrono::nanoseconds( 0 );
+		std::size_t              m_byteBudget = 0;  // =  sizeof  뷫 ũ
+	};
+
+	// INCREMENTAL 忡 Index  ( ex. std::vector )  Ⱑ ٲ   [ m_beginIndex, m_endIndex ). Set Բ ѱ,
+	//  ִ Slave ó ٽ  ʰ   ٽ Ѵ. ũ⸦ ٲٴ   ų ٲ ġ  ؾ Ѵ.
+	struct IncrementalDirtyRange
+	{
+		std::size_t m_beginIndex = 0;
+		std::size_t m_endIndex   = 0;
+	};
+
+	struct IncrementalPublishState
+	{
+		bool        m_isStepSupported     = true;   // = false Type    ų Slave Type ޶, Budget ϰ  Step   Ѵ.
+		bool        m_isBuilding          = false;
+		std::size_t m_copiedCount         = 0;      // =   ִ Slave   
+		std::size_t m_totalCount          = 0;      // =  Master  
+		uint64_t    m_stepCount           = 0;
+		uint64_t    m_completeCount       = 0;      // = ϼǾ Slave ü Ƚ
+		uint64_t    m_restartCount        = 0;      // =   ⸦ ݿ  , ó ٽ  Ƚ
+		uint64_t    m_fullCopyCount       = 0;      // = m_isStepSupported false, Budget ϰ  Step    Ƚ
+		uint64_t    m_deferCount          = 0;      // =  ü   Slave а ִ Reader , ϼ Slave ü  Step ̷ Ƚ
+		uint64_t    m_deferStreak         = 0;      // =  ü  ̷ ִ Step .  ü  ۵ бⰡ  üǱ , Ŀ  Readerʹ ϴ.
+		uint64_t    m_overBudgetStepCount = 0;      // = ð Budget BroadcastPtr::INCREMENTAL_OVER_BUDGET_RATIO踦 ѱ Step . Ʒ 
+		uint64_t    m_lastStepNs          = 0;
+		uint64_t    m_worstStepNs         = 0;      // =   PublishStep   ð
+
+		// Step  64 ð Ȯϱ  Budget ݾ ѱ,   ʰ  Step óϱ  Budget ũ ѱ  ִ.
+		// -       std::vector reserve,   Master ٽ ҴǾ Ŀ std::vector Ҵ
+		// -  Ͱ ̹  (  Slave   ),   Slave ޸ 
+		// - ü Step Publish Listener ȣ
+		// - m_isStepSupported false    
+		//  ܿ Step  ٸ Thread CPU ѱ ð ԵǱ , m_worstStepNsٴ m_overBudgetStepCount  ǴѴ.
+	};
+
+	// PublishStep ȿ   , Budget Ѿ ȮѴ.
+	class IncrementalPublishMeter
+	{
+	public:
+		explicit IncrementalPublishMeter( const IncrementalPublishBudget& budget )
+			: m_budget   ( budget                           )
+			, m_startTime( std::chrono::steady_clock::now() )
+			, m_bytes    ( 0                                )
+			, m_count    ( 0                                )
+		{
+		}
+
+		//  ϳ ó  ȣ. Budget  ٸ false ȯѴ. ð Ź  ʰ   ȮѴ.
+		bool Consume( const std::size_t bytes )
+		{
+			m_bytes += bytes;
+			if ( ++m_count % 64 == 0 || m_budget.m_byteBudget )
+				return !IsOver();
+
+			return true;
+		}
+
+		NODISCARD bool HasLimit() const
+		{
+			return m_budget.m_byteBudget || m_budget.m_timeBudget.count();
+		}
+
+		NODISCARD bool IsOver() const
+		{
+			if ( m_budget.m_byteBudget && m_bytes >= m_budget.m_byteBudget )
+				return true;
+
+			return m_budget.m_timeBudget.count() && std::chrono::steady_clock::now() - m_startTime >= m_budget.m_timeBudget;
+		}
+
+	private:
+		const IncrementalPublishBudget              m_budget;
+		const std::chrono::steady_clock::time_point m_startTime;
+		std::size_t                                 m_bytes;
+		std::size_t                                 m_count;
+	};
+
+	// INCREMENTAL 忡 ͸  Step  , ҸŰ  Trait. Ưȭ  Type  Step   ϸ,
+	// ̴ IncrementalPublishState m_isStepSupported, m_fullCopyCount   ִ.
+	template < class _DataType >
+	struct IncrementalCopy
+	{
+		static constexpr bool IS_SUPPORTED       = false;
+		static constexpr bool IS_REPLAYABLE      = false;  // =   ⸦,  ִ Ϳ ٽ Ͽ ݿ  ִ
+		static constexpr bool IS_RANGE_TRACKABLE = false;  // =   ⸦, IncrementalDirtyRange  ٽ Ͽ ݿ  ִ
+		using CursorType = std::size_t;
+	};
+
+	template < class _KeyType, class _ValueType, class _CompareType, class _AllocType >
+	struct IncrementalCopy< std::map< _KeyType, _ValueType, _CompareType, _AllocType > >
+	{
+		using DataType = std::map< _KeyType, _ValueType, _CompareType, _AllocType >;
+
+		// ̹  Key Master  ⸦ ٽ ϰ,    Key ߿ Master   , Ⱑ ־ ̾   ִ.
+		// , DOUBLING   Լ Key    Ѵ. ( ex. size()  ޶    )
+		static constexpr bool IS_SUPPORTED       = true;
+		static constexpr bool IS_REPLAYABLE      = true;
+		static constexpr bool IS_RANGE_TRACKABLE = false;
+
+		struct CursorType
+		{
+			bool     m_isStarted = false;
+			_KeyType m_nextKey   = _KeyType();
+		};
+
+		NODISCARD static std::size_t GetCount( const DataType& data ) { return data.size(); }
+
+		// ϼǾٸ true ȯѴ.
+		static bool CopyStep( const DataType& masterData, DataType& buildData, CursorType& cursor, std::size_t& copiedCount, IncrementalPublishMeter& meter )
+		{
+			auto iter = cursor.m_isStarted ? masterData.lower_bound( cursor.m_nextKey ) : masterData.begin();
+			while ( iter != masterData.end() )
+			{
+				buildData.insert_or_assign( buildData.end(), iter->first, iter->second );
+				++iter;
+				++copiedCount;
+
+				if ( !meter.Consume( sizeof( typename DataType::value_type ) ) )
+					break;
+			}
+
+			if ( iter == masterData.end() )
+				return true;
+
+			cursor.m_isStarted = true;
+			cursor.m_nextKey   = iter->first;
+			return false;
+		}
+
+		//  Ҹߴٸ true ȯѴ.
+		static bool DestroyStep( DataType& data, IncrementalPublishMeter& meter )
+		{
+			while ( !data.empty() )
+			{
+				data.erase( data.begin() );
+				if ( !meter.Consume( sizeof( typename DataType::value_type ) ) )
+					break;
+			}
+
+			return data.empty();
+		}
+	};
+
+	template < class _ValueType, class _AllocType >
+	struct IncrementalCopy< std::vector< _ValueType, _AllocType > >
+	{
+		using DataType = std::vector< _ValueType, _AllocType >;
+
+		// Index ̶   ⸦ ٽ    , IncrementalDirtyRange   ó ٽ .
+		//  Բ ѱ , ̹  ġ  ξٰ ϼ  ٽ Ѵ.    ġ ߿ Master  ȴ.
+		static constexpr bool IS_SUPPORTED       = true;
+		static constexpr bool IS_REPLAYABLE      = false;
+		static constexpr bool IS_RANGE_TRACKABLE = true;
+
+		struct CursorType
+		{
+			std::size_t                          m_nextIndex = 0;
+			std::vector< IncrementalDirtyRange > m_dirtyRangeCont;  // = ̹  Ŀ ٲ, ٽ ؾ ϴ 
+		};
+
+		NODISCARD static std::size_t GetCount( const DataType& data ) { return data.size(); }
+
+		static void MarkDirty( CursorType& cursor, const IncrementalDirtyRange& dirtyRange )
+		{
+			const std::size_t endIndex = std::min( dirtyRange.m_endIndex, cursor.m_nextIndex );
+			if ( dirtyRange.m_beginIndex >= endIndex )
+				return;
+
+			//  Tick    찡  ,   ġų ´´ٸ ģ.
+			if ( !cursor.m_dirtyRangeCont.empty() )
+			{
+				IncrementalDirtyRange& lastRange = cursor.m_dirtyRangeCont.back();
+				if ( dirtyRange.m_beginIndex <= lastRange.m_endIndex && lastRange.m_beginIndex <= endIndex )
+				{
+					lastRange.m_beginIndex = std::min( lastRange.m_beginIndex, dirtyRange.m_beginIndex );
+					lastRange.m_endIndex   = std::max( lastRange.m_endIndex,   endIndex                );
+					return;
+				}
+			}
+
+			cursor.m_dirtyRangeCont.push_back( { dirtyRange.m_beginIndex, endIndex } );
+		}
+
+		static bool CopyStep( const DataType& masterData, DataType& buildData, CursorType& cursor, std::size_t& copiedCount, IncrementalPublishMeter& meter )
+		{
+			//   Master þ ٽ Ҵ ʵ, Master Capacityŭ  д. (  Ͷ ̹  ִ )
+			if ( cursor.m_nextIndex == 0 )
+				buildData.reserve( masterData.capacity() );
+
+			//  ߿ Master پٸ, ġ Ҹ .
+			if ( buildData.size() > masterData.size() )
+			{
+				buildData.erase( buildData.begin() + masterData.size(), buildData.end() );
+				cursor.m_nextIndex = masterData.size();
+				copiedCount        = masterData.size();
+			}
+
+			while ( cursor.m_nextIndex < masterData.size() )
+			{
+				buildData.emplace_back( masterData[ cursor.m_nextIndex++ ] );
+				++copiedCount;
+
+				if ( !meter.Consume( sizeof( _ValueType ) ) )
+					break;
+			}
+
+			if ( cursor.m_nextIndex < masterData.size() )
+				return false;
+
+			while ( !cursor.m_dirtyRangeCont.empty() )
+			{
+				IncrementalDirtyRange& dirtyRange = cursor.m_dirtyRangeCont.back();
+				const std::size_t      endIndex   = std::min( dirtyRange.m_endIndex, buildData.size() );
+
+				while ( dirtyRange.m_beginIndex < endIndex )
+				{
+					buildData[ dirtyRange.m_beginIndex ] = masterData[ dirtyRange.m_beginIndex ];
+					++dirtyRange.m_beginIndex;
+
+					if ( !meter.Consume( sizeof( _ValueType ) ) )
+						break;
+				}
+
+				if ( dirtyRange.m_beginIndex < endIndex )
+					return false;
+
+				cursor.m_dirtyRangeCont.pop_back();
+			}
+
+			return true;
+		}
+
+		static bool DestroyStep( DataType& data, IncrementalPublishMeter& meter )
+		{
+			if constexpr ( std::is_trivially_destructible_v< _ValueType > )
+			{
+				data.clear();
+			}
+			else
+			{
+				while ( !data.empty() )
+				{
+					data.pop_back();
+					if ( !meter.Consume( sizeof( _ValueType ) ) )
+						break;
+				}
+			}
+
+			return data.empty();
+		}
+	};
+
+	// Master -> Slave ȯ. ⺻ Slave Type Master ͷ ϴ ,  Type̸ , FlatMap̸ FlatMap ڸ  ȯ ȴ.
+	// ٸ ȯ ʿϴٸ,   Make  Type BroadcastPtr 4° ڷ ѱ.
+	template < class _DataType, class _SlaveDataType >
+	struct SlaveTransform
+	{
+		NODISCARD static _SlaveDataType* Make( const _DataType& masterData )
+		{
+			return new _SlaveDataType( masterData );
+		}
+	};
+
+	template <
+		class _ContextKeyType,
+		class _DataType,
+		class _SlaveDataType = _DataType,
+		class _TransformType = SlaveTransform< _DataType, _SlaveDataType > >
 	class BroadcastPtr
 	{
 #pragma region [ Def ]
+		// Slave Type ٸ Master  ൿ Slave ״    , DOUBLING COPY óȴ.
+		static constexpr bool IS_SAME_SLAVE_TYPE = std::is_same_v< _DataType, _SlaveDataType >;
+
+		// ADAPTIVE
+		static constexpr uint64_t ADAPTIVE_PROBE_INTERVAL     = 32;  // = õ  ĵ,  Ƚ   Ͽ  Ѵ.
+		static constexpr uint64_t ADAPTIVE_HYSTERESIS_PERCENT = 20;  // = ٸ    ̻ ξ ȯ Ѵ.
+		static constexpr uint64_t ADAPTIVE_SWITCH_VOTE_COUNT  = 4;   // =     Ƚŭ ؾ ȯѴ.
+
+		static constexpr uint64_t INCREMENTAL_OVER_BUDGET_RATIO = 2;  // = Step ð Budget   ѱ, Budget Ű  Step .
+
+		// INCREMENTAL 忡 Master Slave Lock  ü  Slave,  Ҹų  ִ ˱  Reader Epoch Ѵ. ( BroadcastVector   )
+		class ReadGuard
+		{
+		public:
+			explicit ReadGuard( const BroadcastPtr& owner )
+				: m_owner( owner              )
+				, m_epoch( owner._EnterRead() )
+			{
+			}
+
+			~ReadGuard()
+			{
+				m_owner._LeaveRead( m_epoch );
+			}
+
+			ReadGuard( const ReadGuard& )            = delete;
+			ReadGuard& operator=( const ReadGuard& ) = delete;
+
+		private:
+			const BroadcastPtr& m_owner;
+			const uint64_t      m_epoch;
+		};
 #pragma endregion
 
 #pragma region [ Public Func ]
 	public:
 		BroadcastPtr( const std::function< _DataType*() >& initFunc /*= nullptr*/ )
-			: m_masterData( nullptr )
-			, m_slaveData ( nullptr )
-			, m_slaveLock (         )
+			: m_masterData           ( nullptr             )
+			, m_masterLock           (                     )
+			, m_publishType          ( PUBLISH_TYPE::EAGER )
+			, m_masterVersion        ( 0                   )
+			, m_slaveData            ( nullptr             )
+			, m_slaveLock            (                     )
+			, m_slaveVersion         ( 0                   )
+			, m_readEpoch            ( 0                   )
+			, m_readerCount          {                     }
+			, m_materializeLock      (                     )
+			, m_copyCount            ( 0                   )
+			, m_skipCount            ( 0                   )
+			, m_publishListener      ( nullptr             )
+			, m_isApplyingToMaster   ( false               )
+			, m_isWriteLogged        ( false               )
+			, m_hasUnloggedWrite     ( false               )
+			, m_adaptiveSyncType     ( SYNC_TYPE::COPY     )
+			, m_adaptiveCostNs       {                     }
+			, m_doublingCount        ( 0                   )
+			, m_doublingFallbackCount( 0                   )
+			, m_adaptiveSwitchCount  ( 0                   )
+			, m_adaptiveProbeCount   ( 0                   )
+			, m_adaptiveSwitchVote   ( 0                   )
+			, m_hasPendingChange     ( false               )
+			, m_buildData            ( nullptr             )
+			, m_buildCursor          (                     )
+			, m_isBuildReady         ( false               )
+			, m_retiringData         ( nullptr             )
+			, m_retiredCont          (                     )
+			, m_spareData            ( nullptr             )
+			, m_incrementalState     (                     )
 		{
 			// multi-thread safe?
 			
 			if ( initFunc )
 			{
 				m_masterData = initFunc();
-				m_slaveData  = m_masterData ? new _DataType( *m_masterData ) : nullptr;
+				m_slaveData.store( m_masterData ? _TransformType::Make( *m_masterData ) : nullptr, std::memory_order_release );
 			}
 
-			// и δ , nullptr ¿   ũٰ ϱ ,  κп ⺻ ڸ ȣϿ ó Ѵ.
+			// и δ , nullptr ¿   ũٰ ϱ ,  κп ⺻ ڸ ȣϿ ó Ѵ.
 			if ( !m_masterData )
 			{
 				m_masterData = new _DataType();
-				m_slaveData  = new _DataType( *m_masterData );
+				m_slaveData.store( _TransformType::Make( *m_masterData ), std::memory_order_release );
 			}
 		}
 
 		~BroadcastPtr()
 		{
 			// unsafe
-			if ( m_masterData ) { delete m_masterData; }
+			if ( m_masterData   ) { delete m_masterData;   }
+			if ( m_buildData    ) { delete m_buildData;    }
+			if ( m_retiringData ) { delete m_retiringData; }
+			if ( m_spareData    ) { delete m_spareData;    }
+			for ( _DataType* retiredData : m_retiredCont ) { delete retiredData; }
 
 			std::lock_guard local( m_slaveLock );
-			if ( m_slaveData ) { delete m_slaveData; }
+			if ( _SlaveDataType* slaveData = m_slaveData.load( std::memory_order_acquire ) ) { delete slaveData; }
 		}
 
 		NODISCARD const _DataType& Get( const _ContextKeyType& )
@@ -80,24 +497,57 @@ namespace WonSY::Concurrency
 			return *m_masterData;
 		}
 
-		const _DataType GetCopy()
+		const _SlaveDataType GetCopy()
 		{
+			_MaterializeIfStale();
+
 			std::shared_lock localLock( m_slaveLock );
-			
+			const ReadGuard  readGuard( *this );
+
 			// copy!!
-			return m_slaveData ? *m_slaveData : _DataType();
+			const _SlaveDataType* slaveData = m_slaveData.load( std::memory_order_acquire );
+			return slaveData ? *slaveData : _SlaveDataType();
 		};
 
-		const void RunReadOnlyTask( const std::function< void( const _DataType& ) >& func )
+		const void RunReadOnlyTask( const std::function< void( const _SlaveDataType& ) >& func )
 		{
+			_MaterializeIfStale();
+
+			// Slave Lock DOUBLINGó Slave  ϴ  , Epoch  INCREMENTAL 忡 Lock  ü  Slave Ҹ ´.
 			std::shared_lock localLock( m_slaveLock );
-			func( *m_slaveData );
+			const ReadGuard  readGuard( *this );
+			func( *m_slaveData.load( std::memory_order_acquire ) );
 		}
 
 		void Set( const _ContextKeyType& contextKey, const _DataType& data )
 		{
+			// ü ٲٴ  Op ϵ  .
+			m_hasUnloggedWrite = true;
+
+			if ( m_publishType == PUBLISH_TYPE::INCREMENTAL )
+			{
+				// ü ٲ ,  Slave   PublishStep ٽ .
+				*m_masterData = data;
+				_RestartIncrementalBuild();
+				m_hasPendingChange = true;
+				return;
+			}
+
+			if ( m_publishType == PUBLISH_TYPE::LAZY )
+			{
+				{
+					std::lock_guard local( m_masterLock );
+					*m_masterData = data;
+					_MarkSlaveStale();
+				}
+
+				_NotifyPublish();
+				return;
+			}
+
 			*m_masterData = data;
 			_CopyMasterToSlave( contextKey );
+			_NotifyPublish();
 		}
 
 		bool Set( 
@@ -105,26 +555,67 @@ namespace WonSY::Concurrency
 			const std::function< bool/* =     */( _DataType& ) >& func,
 			const SYNC_TYPE                                                           syncType = SYNC_TYPE::COPY )
 		{
-			if ( func( *m_masterData ) )
+			if ( m_publishType == PUBLISH_TYPE::INCREMENTAL )
 			{
-				// MasterData Ǿ , Lock , SlaveData  õѴ.
+				if ( !_ApplyToMaster( func ) )
+					return false;
+
+				//  ִ Slave  ⸦ ݿϸ, ݿ  ٸ ó ٽ .
+				if ( m_buildData )
+				{
+					if constexpr ( IncrementalCopy< _DataType >::IS_REPLAYABLE )
+					{
+						if ( !func( *m_buildData ) )
+							_RestartIncrementalBuild();
+					}
+					else
+					{
+						_RestartIncrementalBuild();
+					}
+				}
+
+				if ( !m_buildData )
+					m_hasPendingChange = true;
+
+				return true;
+			}
+
+			if ( m_publishType == PUBLISH_TYPE::LAZY )
+			{
+				// LAZY 忡 Slave Stale  ֱ , DOUBLING  ʰ syncType ϰ Stale ǥø Ѵ.
+				{
+					std::lock_guard local( m_masterLock );
+					if ( !_ApplyToMaster( func ) )
+						return false;
+
+					_MarkSlaveStale();
+				}
+
+				_NotifyPublish();
+				return true;
+			}
+
+			if ( _ApplyToMaster( func ) )
+			{
+				// MasterData Ǿ , Lock , SlaveData  õѴ.
 				
-				if ( syncType == SYNC_TYPE::COPY )
+				if ( syncType == SYNC_TYPE::ADAPTIVE )
 				{
-					_CopyMasterToSlave( contextKey );
-					return true;
+					// Slave Lock ٸ ð Reader д ð   İ ϱ ,     븸 Ѵ.
+					std::chrono::steady_clock::duration lockWaitTime{};
+
+					const SYNC_TYPE selectedSyncType = _SelectAdaptiveSyncType();
+					const auto      startTime        = std::chrono::steady_clock::now();
+					const bool      isFallback       = _SyncMasterToSlave( contextKey, func, selectedSyncType, &lockWaitTime );
+
+					_UpdateAdaptiveSyncType( selectedSyncType, isFallback, std::chrono::steady_clock::now() - startTime - lockWaitTime );
 				}
-				else if ( const bool slaveReplicateResult =
-					[ & ]
-					{
-						std::lock_guard local( m_slaveLock );
-						return func( *m_slaveData );
-					}(); !slaveReplicateResult )
+				else
 				{
-					// ̺꿡  Ϳ  Լ   ,  īش.
-					_CopyMasterToSlave( contextKey );
+					_SyncMasterToSlave( contextKey, func, syncType );
 				}
 
+				_NotifyPublish();
 				return true;
 			}
 			else
@@ -133,18 +624,555 @@ namespace WonSY::Concurrency
 			}
 		}
 
+		// ٲ  Բ ѱ . INCREMENTAL 忡    ִ Type̶,  ִ Slave  ʰ   ٽ Ѵ.
+		//  ܿ   Set .
+		bool Set(
+			const _ContextKeyType&                                                    contextKey,
+			const std::function< bool/* =     */( _DataType& ) >& func,
+			const IncrementalDirtyRange&                                              dirtyRange,
+			const SYNC_TYPE                                                           syncType = SYNC_TYPE::COPY )
+		{
+			if constexpr ( IncrementalCopy< _DataType >::IS_RANGE_TRACKABLE )
+			{
+				if ( m_publishType == PUBLISH_TYPE::INCREMENTAL )
+				{
+					if ( !_ApplyToMaster( func ) )
+						return false;
+
+					if ( m_buildData )
+					{
+						IncrementalCopy< _DataType >::MarkDirty( m_buildCursor, dirtyRange );
+						m_isBuildReady = false;
+					}
+					else
+					{
+						m_hasPendingChange = true;
+					}
+
+					return true;
+				}
+			}
+
+			return Set( contextKey, func, syncType );
+		}
+
+		void SetPublishType( const _ContextKeyType& contextKey, const PUBLISH_TYPE publishType )
+		{
+			if ( m_publishType == publishType )
+				return;
+
+			// INCREMENTAL  ,  Slave   ݿ   ٷ ݿѴ.
+			if ( m_publishType == PUBLISH_TYPE::INCREMENTAL )
+				_AbortIncrementalPublish( contextKey );
+
+			// Materialize  Reader Master а   ֱ , Master Lock  带 Ѵ.
+			std::lock_guard local( m_masterLock );
+
+			// LAZY   Master  Master Lock  Ͼ Reader Materialize   , Stale Slave ⼭ ֽ .
+			if ( m_publishType == PUBLISH_TYPE::LAZY && publishType != PUBLISH_TYPE::EAGER )
+			{
+				std::lock_guard materializeLock( m_materializeLock );
+				_MaterializeSlave();
+			}
+
+			m_publishType = publishType;
+
+			// EAGER ư ,  Master  Lock  Ͼ  ⼭ Slave ֽ д.
+			if ( publishType == PUBLISH_TYPE::EAGER )
+				_CopyMasterToSlave( contextKey );
+		}
+
+		NODISCARD PUBLISH_TYPE GetPublishType( const _ContextKeyType& ) const
+		{
+			return m_publishType;
+		}
+
+		// Master Context Safe Point( ex. Tick  ) ȣϿ, Stale Slave ̸ ֽ . EAGER 忡 ƹ͵  ʴ´.
+		// INCREMENTAL 忡 Budget   Step  ϸ,  Slave а ִ Reader ⸦ ٸ.
+		void Publish( const _ContextKeyType& contextKey )
+		{
+			if ( m_publishType == PUBLISH_TYPE::INCREMENTAL )
+			{
+				while ( !PublishStep( contextKey, IncrementalPublishBudget() ) ) {}
+				return;
+			}
+
+			if ( !_IsSlaveStale() )
+				return;
+
+			// Master Context ڽ̱  Master Lock ʿ , ÿ Materialize  Reader ߺ 縦 ´.
+			std::lock_guard materializeLock( m_materializeLock );
+			_MaterializeSlave();
+		}
+
+		// INCREMENTAL  Master Context  Tick ȣѴ. Budget   Slave , ϼǸ Slave üѴ.
+		//  Slave Ҹ굵 Step  óϸ,  ̻   ٸ true ȯѴ. Budget ִٸ Reader ٸ ʴ´.
+		bool PublishStep( const _ContextKeyType& contextKey, const IncrementalPublishBudget& budget )
+		{
+			if ( m_publishType != PUBLISH_TYPE::INCREMENTAL )
+				return true;
+
+			const auto              startTime = std::chrono::steady_clock::now();
+			IncrementalPublishMeter meter( budget );
+			const bool              isDone    = _RunPublishStep( contextKey, meter );
+
+			m_incrementalState.m_lastStepNs  = std::chrono::duration_cast< std::chrono::nanoseconds >( std::chrono::steady_clock::now() - startTime ).count();
+			m_incrementalState.m_worstStepNs = std::max( m_incrementalState.m_worstStepNs, m_incrementalState.m_lastStepNs );
+			++m_incrementalState.m_stepCount;
+
+			if ( budget.m_timeBudget.count() && m_incrementalState.m_lastStepNs > static_cast< uint64_t >( budget.m_timeBudget.count() ) * INCREMENTAL_OVER_BUDGET_RATIO )
+				++m_incrementalState.m_overBudgetStepCount;
+
+			return isDone;
+		}
+
+		NODISCARD IncrementalPublishState GetIncrementalPublishState( const _ContextKeyType& ) const
+		{
+			IncrementalPublishState state = m_incrementalState;
+			state.m_isStepSupported = IncrementalCopy< _DataType >::IS_SUPPORTED && IS_SAME_SLAVE_TYPE;
+			if constexpr ( IncrementalCopy< _DataType >::IS_SUPPORTED )
+				state.m_totalCount = IncrementalCopy< _DataType >::GetCount( *m_masterData );
+
+			return state;
+		}
+
+		// Master Context. Set ѱ Լ ȿ, ̹ ⸦ Op-Logó    ȣѴ. ߴٰ ǥõ  ( Set( data )  )
+		//  Publish, Listener hasUnloggedWrite ˸. DOUBLING, INCREMENTAL  Լ Slave ٽ Ǳ ,
+		// Լ Master Ϳ Ǵ   ǥϰ true ȯѴ. Op-Logó   Ͼ ϴ μ ȿ   óѴ.
+		bool MarkWriteLogged( const _ContextKeyType& )
+		{
+			if ( !m_isApplyingToMaster )
+				return false;
+
+			m_isWriteLogged = true;
+			return true;
+		}
+
+		// Set  Publish  , Master Context Master , Version, ׸ MarkWriteLogged  Ͼ Ⱑ ̹ Publish  ڷ ȣȴ.
+		// INCREMENTAL 忡  Set ϳ Publish . ( ex. BroadcastPublisher )
+		void SetPublishListener( const _ContextKeyType&, const std::function< void( const _DataType&, uint64_t, bool ) >& listener )
+		{
+			m_publishListener = listener;
+		}
+
+		// ADAPTIVE Set ,     ٰŸ ȯѴ.  Context ȣ  ִ.
+		NODISCARD AdaptiveSyncState GetAdaptiveSyncState() const
+		{
+			AdaptiveSyncState state;
+			state.m_syncType              = m_adaptiveSyncType.load( std::memory_order_relaxed );
+			state.m_copyCostNs            = m_adaptiveCostNs[ _ToAdaptiveIndex( SYNC_TYPE::COPY     ) ].load( std::memory_order_relaxed );
+			state.m_doublingCostNs        = m_adaptiveCostNs[ _ToAdaptiveIndex( SYNC_TYPE::DOUBLING ) ].load( std::memory_order_relaxed );
+			state.m_doublingCount         = m_doublingCount        .load( std::memory_order_relaxed );
+			state.m_doublingFallbackCount = m_doublingFallbackCount.load( std::memory_order_relaxed );
+			state.m_switchCount           = m_adaptiveSwitchCount  .load( std::memory_order_relaxed );
+			return state;
+		}
+
+		NODISCARD BroadcastStat GetStat() const
+		{
+			BroadcastStat stat;
+			stat.m_publishCount = m_masterVersion.load( std::memory_order_acquire );
+			stat.m_copyCount    = m_copyCount.load( std::memory_order_relaxed );
+			stat.m_skipCount    = m_skipCount.load( std::memory_order_relaxed );
+			return stat;
+		}
+
 #pragma endregion
 
 #pragma region [ Private Func ]
 	private:
-		void _CopyMasterToSlave( const _ContextKeyType& )
+		// Master Context. Լ Master Ϳ ϴ ȸ m_isApplyingToMaster ǥϰ,  MarkWriteLogged ϵǾ ȮѴ.
+		bool _ApplyToMaster( const std::function< bool( _DataType& ) >& func )
+		{
+			struct ApplyingGuard
+			{
+				explicit ApplyingGuard( bool& isApplying ) : m_isApplying( isApplying ) { m_isApplying = true;  }
+				~ApplyingGuard()                                                        { m_isApplying = false; }
+
+				bool& m_isApplying;
+			};
+
+			m_isWriteLogged = false;
+
+			bool isChanged = false;
+			{
+				const ApplyingGuard applyingGuard( m_isApplyingToMaster );
+				isChanged = func( *m_masterData );
+			}
+
+			if ( isChanged && !m_isWriteLogged )
+				m_hasUnloggedWrite = true;
+
+			return isChanged;
+		}
+
+		void _NotifyPublish()
+		{
+			const bool hasUnloggedWrite = m_hasUnloggedWrite;
+			m_hasUnloggedWrite = false;
+
+			if ( m_publishListener )
+				m_publishListener( *m_masterData, m_masterVersion.load( std::memory_order_relaxed ), hasUnloggedWrite );
+		}
+
+		// Master   Slave ݿѴ. DOUBLING Ͽ ߴٸ true ȯѴ.
+		bool _SyncMasterToSlave(
+			const _ContextKeyType&                      contextKey,
+			const std::function< bool( _DataType& ) >& func,
+			const SYNC_TYPE                             syncType,
+			std::chrono::steady_clock::duration*        outLockWaitTime = nullptr )
+		{
+			if ( syncType == SYNC_TYPE::COPY || !IS_SAME_SLAVE_TYPE )
+			{
+				_CopyMasterToSlave( contextKey, outLockWaitTime );
+				return false;
+			}
+			else if ( const bool slaveReplicateResult =
+				[ & ]
+				{
+					if constexpr ( IS_SAME_SLAVE_TYPE )
+					{
+						const auto local = _LockSlave( outLockWaitTime );
+						if ( !func( *m_slaveData.load( std::memory_order_relaxed ) ) )
+							return false;
+
+						_PublishSlaveVersion();
+						return true;
+					}
+					else
+					{
+						return false;
+					}
+				}(); !slaveReplicateResult )
+			{
+				// ̺꿡  Ϳ  Լ   ,  īش.
+				_CopyMasterToSlave( contextKey, outLockWaitTime );
+				return true;
+			}
+
+			return false;
+		}
+
+		static constexpr std::size_t _ToAdaptiveIndex( const SYNC_TYPE syncType )
+		{
+			return syncType == SYNC_TYPE::DOUBLING ? 1 : 0;
+		}
+
+		static constexpr SYNC_TYPE _GetOtherSyncType( const SYNC_TYPE syncType )
+		{
+			return syncType == SYNC_TYPE::DOUBLING ? SYNC_TYPE::COPY : SYNC_TYPE::DOUBLING;
+		}
+
+		// Master Context. ̹ Set   .
+		SYNC_TYPE _SelectAdaptiveSyncType()
+		{
+			if constexpr ( !IS_SAME_SLAVE_TYPE )
+			{
+				return SYNC_TYPE::COPY;
+			}
+			else
+			{
+				const SYNC_TYPE currentSyncType = m_adaptiveSyncType.load( std::memory_order_relaxed );
+				const SYNC_TYPE otherSyncType   = _GetOtherSyncType( currentSyncType );
+
+				//   ʾҰų,   ̶   Ͽ  Ѵ. COPY õǾ ִ DOUBLING   ִ.
+				if (
+					m_adaptiveCostNs[ _ToAdaptiveIndex( otherSyncType ) ].load( std::memory_order_relaxed ) == 0 ||
+					++m_adaptiveProbeCount % ADAPTIVE_PROBE_INTERVAL == 0 )
+				{
+					return otherSyncType;
+				}
+
+				return currentSyncType;
+			}
+		}
+
+		// Master Context.   ݿϰ, ٸ    δٸ ȯѴ.
+		void _UpdateAdaptiveSyncType( const SYNC_TYPE selectedSyncType, const bool isFallback, const std::chrono::steady_clock::duration elapsedTime )
+		{
+			const uint64_t sampleNs = std::max< uint64_t >( 1, std::chrono::duration_cast< std::chrono::nanoseconds >( elapsedTime ).count() );
+
+			auto&          costNs    = m_adaptiveCostNs[ _ToAdaptiveIndex( selectedSyncType ) ];
+			const uint64_t oldCostNs = costNs.load( std::memory_order_relaxed );
+			costNs.store( oldCostNs ? ( oldCostNs * 7 + sampleNs ) / 8 : sampleNs, std::memory_order_relaxed );
+
+			if ( selectedSyncType == SYNC_TYPE::DOUBLING )
+			{
+				m_doublingCount.fetch_add( 1, std::memory_order_relaxed );
+				if ( isFallback )
+					m_doublingFallbackCount.fetch_add( 1, std::memory_order_relaxed );
+			}
+
+			const SYNC_TYPE currentSyncType = m_adaptiveSyncType.load( std::memory_order_relaxed );
+			const SYNC_TYPE otherSyncType   = _GetOtherSyncType( currentSyncType );
+			const uint64_t  currentCostNs   = m_adaptiveCostNs[ _ToAdaptiveIndex( currentSyncType ) ].load( std::memory_order_relaxed );
+			const uint64_t  otherCostNs     = m_adaptiveCostNs[ _ToAdaptiveIndex( otherSyncType   ) ].load( std::memory_order_relaxed );
+
+			if ( !currentCostNs || !otherCostNs || otherCostNs * 100 >= currentCostNs * ( 100 - ADAPTIVE_HYSTERESIS_PERCENT ) )
+			{
+				m_adaptiveSwitchVote = 0;
+				return;
+			}
+
+			if ( ++m_adaptiveSwitchVote >= ADAPTIVE_SWITCH_VOTE_COUNT )
+			{
+				m_adaptiveSwitchVote = 0;
+				m_adaptiveSyncType.store( otherSyncType, std::memory_order_relaxed );
+				m_adaptiveSwitchCount.fetch_add( 1, std::memory_order_relaxed );
+			}
+		}
+
+		// Master Context.   ִٸ false ȯѴ.
+		bool _RunPublishStep( const _ContextKeyType& contextKey, IncrementalPublishMeter& meter )
+		{
+			using _CopyType = IncrementalCopy< _DataType >;
+
+			if constexpr ( !_CopyType::IS_SUPPORTED || !IS_SAME_SLAVE_TYPE )
+			{
+				//     Type Budget ϰ  Step   Ѵ.
+				if ( m_hasPendingChange )
+				{
+					m_hasPendingChange = false;
+					_CopyMasterToSlave( contextKey );
+					++m_incrementalState.m_completeCount;
+					++m_incrementalState.m_fullCopyCount;
+					_NotifyPublish();
+				}
+
+				return true;
+			}
+			else
+			{
+				// ü   Reader    Slave,  Ҹų  ű.
+				_TryRetireSlave( !meter.HasLimit() );
+
+				//  Slave  Slave  .   ϳ ޸𸮸  ʰ,  ⿡ Ѵ.
+				while ( !m_retiredCont.empty() )
+				{
+					if ( !_CopyType::DestroyStep( *m_retiredCont.back(), meter ) )
+						return false;
+
+					if ( m_spareData )
+						delete m_retiredCont.back();
+					else
+						m_spareData = m_retiredCont.back();
+
+					m_retiredCont.pop_back();
+
+					if ( meter.IsOver() )
+						return false;
+				}
+
+				if ( !m_buildData )
+				{
+					if ( !m_hasPendingChange )
+						return !m_retiringData;
+
+					// ݺ   ִ Slave ݿȴ.
+					m_hasPendingChange               = false;
+					m_buildData                      = m_spareData ? m_spareData : new _DataType();
+					m_spareData                      = nullptr;
+					m_buildCursor                    = typename _CopyType::CursorType();
+					m_incrementalState.m_isBuilding  = true;
+					m_incrementalState.m_copiedCount = 0;
+				}
+
+				if ( !m_isBuildReady )
+				{
+					if ( !_CopyType::CopyStep( *m_masterData, *m_buildData, m_buildCursor, m_incrementalState.m_copiedCount, meter ) )
+						return false;
+
+					m_isBuildReady = true;
+				}
+
+				// ϼǾٸ Slave üѴ. ͸ ٲٱ  Reader ٸ , а ִ Reader  Slave  д´.
+				// , Reader  Epoch Ȧ¦θ ϱ ,  ü Slave д Reader  ִٸ  Step ̷.
+				// ̴  ü  ۵ б⸸ ٸ ,  Ŀ   Reader  ̷ ʴ´.
+				if ( m_retiringData )
+				{
+					++m_incrementalState.m_deferStreak;
+					++m_incrementalState.m_deferCount;
+					return false;
+				}
+
+				_DataType* const buildData = m_buildData;
+				m_buildData                = nullptr;
+
+				m_retiringData = m_slaveData.exchange( buildData, std::memory_order_acq_rel );
+				m_readEpoch.fetch_add( 1, std::memory_order_seq_cst );
+				_PublishSlaveVersion();
+
+				//  Slave ü   Reader   ,  Step  ҸŲ.
+				m_isBuildReady                   = false;
+				m_incrementalState.m_deferStreak = 0;
+				m_copyCount.fetch_add( 1, std::memory_order_relaxed );
+				m_incrementalState.m_isBuilding = false;
+				++m_incrementalState.m_completeCount;
+
+				_NotifyPublish();
+				return false;
+			}
+		}
+
+		// Master Context.  Slave ,  PublishStep ó ٽ .
+		void _RestartIncrementalBuild()
+		{
+			if ( !m_buildData )
+				return;
+
+			m_retiredCont.emplace_back( m_buildData );
+			m_buildData    = nullptr;
+			m_isBuildReady = false;
+
+			m_hasPendingChange               = true;
+			m_incrementalState.m_isBuilding  = false;
+			m_incrementalState.m_copiedCount = 0;
+			++m_incrementalState.m_restartCount;
+		}
+
+		// Master Context. INCREMENTAL 带   ȣ.     ݿѴ.
+		void _AbortIncrementalPublish( const _ContextKeyType& contextKey )
+		{
+			_RestartIncrementalBuild();
+			_TryRetireSlave( true );
+
+			for ( _DataType* retiredData : m_retiredCont )
+				delete retiredData;
+
+			m_retiredCont.clear();
+
+			if ( m_spareData )
+			{
+				delete m_spareData;
+				m_spareData = nullptr;
+			}
+
+			if ( m_hasPendingChange )
+			{
+				m_hasPendingChange = false;
+				_CopyMasterToSlave( contextKey );
+				_NotifyPublish();
+			}
+		}
+
+		// Master Context. ü  Slave   ִ, ü  Epoch Reader  ٸ Ҹų  ű. isWait   ٸ.
+		void _TryRetireSlave( const bool isWait )
 		{
-			_DataType* tempPtr = m_masterData ? new _DataType( *m_masterData ) : nullptr;
+			if ( !m_retiringData )
+				return;
+
+			// Epoch  Reader  Ȯ, _EnterRead ϰ Epoch Ȯο  ϳ   ϱ  seq_cst д´.
+			const uint64_t oldEpoch = m_readEpoch.load( std::memory_order_relaxed ) - 1;
+			while ( m_readerCount[ oldEpoch & 1 ].load( std::memory_order_seq_cst ) != 0 )
+			{
+				if ( !isWait )
+					return;
+
+				std::this_thread::yield();
+			}
+
+			m_retiredCont.emplace_back( m_retiringData );
+			m_retiringData = nullptr;
+		}
+
+		uint64_t _EnterRead() const
+		{
+			while ( true )
+			{
+				const uint64_t epoch = m_readEpoch.load( std::memory_order_seq_cst );
+				m_readerCount[ epoch & 1 ].fetch_add( 1, std::memory_order_seq_cst );
+
+				// ϴ ̿ Epoch ٲٸ, Master  Reader ٸ   ֱ  ٽ Ѵ.
+				if ( m_readEpoch.load( std::memory_order_seq_cst ) == epoch )
+					return epoch;
+
+				m_readerCount[ epoch & 1 ].fetch_sub( 1, std::memory_order_release );
+			}
+		}
+
+		void _LeaveRead( const uint64_t epoch ) const
+		{
+			m_readerCount[ epoch & 1 ].fetch_sub( 1, std::memory_order_release );
+		}
+
+		void _CopyMasterToSlave( const _ContextKeyType&, std::chrono::steady_clock::duration* outLockWaitTime = nullptr )
+		{
+			_SlaveDataType* tempPtr = m_masterData ? _TransformType::Make( *m_masterData ) : nullptr;
+			{
+				const auto local = _LockSlave( outLockWaitTime );
+				tempPtr = m_slaveData.exchange( tempPtr, std::memory_order_acq_rel );
+				_PublishSlaveVersion();
+			}
+
+			m_copyCount.fetch_add( 1, std::memory_order_relaxed );
+
+			if ( tempPtr )
+				delete tempPtr;
+		}
+
+		// Master Context. Slave Lock , outLockWaitTime ִٸ Lock ٸ ð Ѵ.
+		NODISCARD std::unique_lock< std::shared_mutex > _LockSlave( std::chrono::steady_clock::duration* outLockWaitTime )
+		{
+			if ( !outLockWaitTime )
+				return std::unique_lock( m_slaveLock );
+
+			const auto       waitStartTime = std::chrono::steady_clock::now();
+			std::unique_lock local( m_slaveLock );
+			*outLockWaitTime += std::chrono::steady_clock::now() - waitStartTime;
+			return local;
+		}
+
+		// Master Context Slave ٲ  ȣ. ( INCREMENTAL ƴ϶ Slave Lock  ä ) Slave Version  ÷, Reader Stale  ʵ Ѵ.
+		void _PublishSlaveVersion()
+		{
+			const uint64_t version = m_masterVersion.load( std::memory_order_relaxed ) + 1;
+			m_slaveVersion .store( version, std::memory_order_release );
+			m_masterVersion.store( version, std::memory_order_release );
+		}
+
+		// LAZY  Master Context Master Lock  ä ȣ.
+		void _MarkSlaveStale()
+		{
+			//  Version   Slave  ʾҴٸ,    .
+			if ( _IsSlaveStale() )
+				m_skipCount.fetch_add( 1, std::memory_order_relaxed );
+
+			m_masterVersion.store( m_masterVersion.load( std::memory_order_relaxed ) + 1, std::memory_order_release );
+		}
+
+		NODISCARD bool _IsSlaveStale() const
+		{
+			const uint64_t masterVersion = m_masterVersion.load( std::memory_order_acquire );
+			return masterVersion > m_slaveVersion.load( std::memory_order_acquire );
+		}
+
+		void _MaterializeIfStale()
+		{
+			if ( !_IsSlaveStale() )
+				return;
+
+			// Master Lock Shared , Master   ¸ Ѵ. Master LAZY   ׻ Master Lock  Ѵ.
+			std::shared_lock masterLock     ( m_masterLock      );
+			std::lock_guard  materializeLock( m_materializeLock );
+			_MaterializeSlave();
+		}
+
+		// Materialize Lock  ä ȣ. Version ִ 1ȸ Ѵ.
+		void _MaterializeSlave()
+		{
+			const uint64_t version = m_masterVersion.load( std::memory_order_acquire );
+			if ( version <= m_slaveVersion.load( std::memory_order_acquire ) )
+				return;
+
+			_SlaveDataType* tempPtr = _TransformType::Make( *m_masterData );
 			{
 				std::lock_guard local( m_slaveLock );
-				std::swap( m_slaveData, tempPtr );
+				tempPtr = m_slaveData.exchange( tempPtr, std::memory_order_acq_rel );
+				m_slaveVersion.store( version, std::memory_order_release );
 			}
 
+			m_copyCount.fetch_add( 1, std::memory_order_relaxed );
+
 			if ( tempPtr )
 				delete tempPtr;
 		}
@@ -153,10 +1181,44 @@ namespace WonSY::Concurrency
 
 #pragma region [ Member Var ]
 	private:
-		_DataType*        m_masterData;
+		_DataType*              m_masterData;
+		std::shared_mutex       m_masterLock;      // = LAZY 忡 Master  Reader Materialize ̸ ȣ
+		PUBLISH_TYPE            m_publishType;     // = Master Context 
+		std::atomic< uint64_t > m_masterVersion;
 
-		_DataType*        m_slaveData;
-		std::shared_mutex m_slaveLock;
+		std::atomic< _SlaveDataType* > m_slaveData;      // = INCREMENTAL 忡 Slave Lock  üǱ  Atomic д.
+		std::shared_mutex              m_slaveLock;
+		std::atomic< uint64_t >        m_slaveVersion;
+		std::atomic< uint64_t >        m_readEpoch;
+		mutable std::atomic< uint64_t > m_readerCount[ 2 ];  // = Epoch Ȧ¦ а ִ Reader 
+
+		std::mutex              m_materializeLock;
+		std::atomic< uint64_t > m_copyCount;
+		std::atomic< uint64_t > m_skipCount;
+
+		std::function< void( const _DataType&, uint64_t, bool ) > m_publishListener;     // = Master Context 
+		bool                                                      m_isApplyingToMaster;  // = Master Context 
+		bool                                                      m_isWriteLogged;       // = ̹ Լ   MarkWriteLogged ȣǾ. Master Context 
+		bool                                                      m_hasUnloggedWrite;    // =  Publish , ϵ  Ⱑ ־. Master Context 
+
+		// ADAPTIVE.  Master Context, ȸ  Context ϵ Atomic д.
+		std::atomic< SYNC_TYPE >                            m_adaptiveSyncType;
+		std::atomic< uint64_t >                             m_adaptiveCostNs[ 2 ];  // = [ COPY, DOUBLING ]
+		std::atomic< uint64_t >                             m_doublingCount;
+		std::atomic< uint64_t >                             m_doublingFallbackCount;
+		std::atomic< uint64_t >                             m_adaptiveSwitchCount;
+		uint64_t                                            m_adaptiveProbeCount;   // = Master Context 
+		uint64_t                                            m_adaptiveSwitchVote;   // = Master Context 
+
+		// INCREMENTAL.  Master Context 
+		bool                                                m_hasPendingChange;     // = Slave  ݿ ʾҰ,  ִ Slave   ִ
+		_DataType*                                          m_buildData;            // =  ִ  Slave
+		typename IncrementalCopy< _DataType >::CursorType   m_buildCursor;
+		bool                                                m_isBuildReady;         // = Ⱑ , Slave ü Ҵ
+		_DataType*                                          m_retiringData;         // = üǾ, ü   Reader  а   ִ  Slave
+		std::vector< _DataType* >                           m_retiredCont;          // =  Ҹų  Slave  Slave
+		_DataType*                                          m_spareData;            // =    Slave. ū ޸   Ҵ( Page Fault ) Ź  ʵ,  ⿡ Ѵ.
+		IncrementalPublishState                             m_incrementalState;
 #pragma endregion
 
 	};
@@ -360,10 +1422,14 @@ namespace WonSY::Concurrency
 #pragma endregion
 }
 
-template < class _ContextKey, class _DataType >
-using WsyBroadcastPtr = WonSY::Concurrency::BroadcastPtr< _ContextKey, _DataType >;
+template < class _ContextKey, class _DataType, class _SlaveDataType = _DataType >
+using WsyBroadcastPtr = WonSY::Concurrency::BroadcastPtr< _ContextKey, _DataType, _SlaveDataType >;
+
+template < class _KeyType, class _ValueType >
+using WsyFlatMap = WonSY::Concurrency::FlatMap< _KeyType, _ValueType >;
 
-using BROADCAST_SYNC_TYPE = WonSY::Concurrency::SYNC_TYPE;
+using BROADCAST_SYNC_TYPE    = WonSY::Concurrency::SYNC_TYPE;
+using BROADCAST_PUBLISH_TYPE = WonSY::Concurrency::PUBLISH_TYPE;
 
 //template < class _Type >
 //using WsyReplicationPtr = WonSY::Concurrency::ReplicationPtr_ThreadId< _Type >;
\ No newline at end of file
@@ -0,0 +1,697 @@
+/*
+	Copyright 2021, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#include "WonSY_BroadcastReplication.h"
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <map>
+
+#ifdef _WIN32
+	#include <WinSock2.h>
+	#include <WS2tcpip.h>
+	#pragma comment( lib, "ws2_32.lib" )
+#else
+	#include <arpa/inet.h>
+	#include <fcntl.h>
+	#include <netinet/in.h>
+	#include <netinet/tcp.h>
+	#include <poll.h>
+	#include <sys/socket.h>
+	#include <unistd.h>
+#endif
+
+namespace WonSY::Concurrency::Replication
+{
+#ifdef _WIN32
+	using NativeSocket = SOCKET;
+	using SockLenType  = int;
+	using PollFdType   = WSAPOLLFD;
+
+	static void _InitSocketLibrary()
+	{
+		struct WsaInitializer
+		{
+			WsaInitializer()  { WSADATA wsaData; WSAStartup( MAKEWORD( 2, 2 ), &wsaData ); }
+			~WsaInitializer() { WSACleanup(); }
+		};
+
+		static WsaInitializer wsaInitializer;
+	}
+#else
+	using NativeSocket = int;
+	using SockLenType  = socklen_t;
+	using PollFdType   = pollfd;
+
+	static void _InitSocketLibrary() {}
+#endif
+
+#ifdef _WIN32
+	constexpr int SEND_FLAG = 0;
+#else
+	constexpr int SEND_FLAG = MSG_NOSIGNAL;
+#endif
+
+	static NativeSocket _ToNative( const SocketHandle socket ) { return static_cast< NativeSocket >( socket ); }
+
+	static SocketHandle _ToHandle( const NativeSocket socket )
+	{
+#ifdef _WIN32
+		return socket == INVALID_SOCKET ? INVALID_SOCKET_HANDLE : static_cast< SocketHandle >( socket );
+#else
+		return socket < 0 ? INVALID_SOCKET_HANDLE : static_cast< SocketHandle >( socket );
+#endif
+	}
+
+	// select ޸ Socket ( FD_SETSIZE )̳ ( Windows 64 )  .
+	static int _Poll( PollFdType* pollFds, const std::size_t pollFdCount, const int timeoutMs )
+	{
+#ifdef _WIN32
+		return WSAPoll( pollFds, static_cast< ULONG >( pollFdCount ), timeoutMs );
+#else
+		return poll( pollFds, static_cast< nfds_t >( pollFdCount ), timeoutMs );
+#endif
+	}
+
+	static bool _IsWouldBlock()
+	{
+#ifdef _WIN32
+		return WSAGetLastError() == WSAEWOULDBLOCK;
+#else
+		return errno == EAGAIN || errno == EWOULDBLOCK;
+#endif
+	}
+
+	static sockaddr_in _MakeLoopbackAddress( const uint16_t port )
+	{
+		sockaddr_in address;
+		std::memset( &address, 0, sizeof( address ) );
+		address.sin_family      = AF_INET;
+		address.sin_port        = htons( port );
+		address.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+		return address;
+	}
+
+	static void _SetNoDelay( const NativeSocket socket )
+	{
+		// Frame IO Thread ̹ Ƽ  , Nagle  ߰  ʿ .
+		int noDelay = 1;
+		setsockopt( socket, IPPROTO_TCP, TCP_NODELAY, reinterpret_cast< const char* >( &noDelay ), sizeof( noDelay ) );
+	}
+
+	template < class _Type >
+	static void _AppendRaw( std::string& outBuffer, const _Type value )
+	{
+		outBuffer.append( reinterpret_cast< const char* >( &value ), sizeof( value ) );
+	}
+
+	template < class _Type >
+	static const char* _ReadRaw( const char* buffer, _Type& outValue )
+	{
+		std::memcpy( &outValue, buffer, sizeof( outValue ) );
+		return buffer + sizeof( outValue );
+	}
+
+	void AppendFrame( std::string& outBuffer, const FrameHeader& frameHeader, const char* payload )
+	{
+		outBuffer.reserve( outBuffer.size() + FRAME_HEADER_SIZE + frameHeader.m_payloadSize );
+
+		_AppendRaw( outBuffer, frameHeader.m_payloadSize                        );
+		_AppendRaw( outBuffer, static_cast< uint8_t >( frameHeader.m_frameType ) );
+		_AppendRaw( outBuffer, frameHeader.m_version                            );
+		_AppendRaw( outBuffer, frameHeader.m_baseVersion                        );
+		outBuffer.append( payload, frameHeader.m_payloadSize );
+	}
+
+	void ReadFrameHeader( const char* buffer, FrameHeader& outFrameHeader )
+	{
+		uint8_t frameType = 0;
+
+		buffer = _ReadRaw( buffer, outFrameHeader.m_payloadSize );
+		buffer = _ReadRaw( buffer, frameType                    );
+		buffer = _ReadRaw( buffer, outFrameHeader.m_version     );
+		buffer = _ReadRaw( buffer, outFrameHeader.m_baseVersion );
+
+		outFrameHeader.m_frameType = static_cast< FRAME_TYPE >( frameType );
+	}
+
+	void AppendOpRecord( std::string& outBuffer, const char* opData, const std::size_t opSize )
+	{
+		_AppendRaw( outBuffer, static_cast< uint32_t >( opSize ) );
+		outBuffer.append( opData, opSize );
+	}
+
+	bool ForEachOpRecord( const char* payload, const std::size_t payloadSize, const std::function< bool( const char*, std::size_t ) >& func )
+	{
+		const char* payloadEnd = payload + payloadSize;
+		while ( payload < payloadEnd )
+		{
+			if ( static_cast< std::size_t >( payloadEnd - payload ) < sizeof( uint32_t ) )
+				return false;
+
+			uint32_t opSize = 0;
+			payload = _ReadRaw( payload, opSize );
+			if ( static_cast< std::size_t >( payloadEnd - payload ) < opSize )
+				return false;
+
+			if ( !func( payload, opSize ) )
+				return false;
+
+			payload += opSize;
+		}
+
+		return true;
+	}
+
+	SocketHandle ListenLoopback( const uint16_t port )
+	{
+		_InitSocketLibrary();
+
+		const NativeSocket listenSocket = socket( AF_INET, SOCK_STREAM, IPPROTO_TCP );
+		if ( _ToHandle( listenSocket ) == INVALID_SOCKET_HANDLE )
+			return INVALID_SOCKET_HANDLE;
+
+		int reuseAddress = 1;
+		setsockopt( listenSocket, SOL_SOCKET, SO_REUSEADDR, reinterpret_cast< const char* >( &reuseAddress ), sizeof( reuseAddress ) );
+
+		const sockaddr_in address = _MakeLoopbackAddress( port );
+		if (
+			bind( listenSocket, reinterpret_cast< const sockaddr* >( &address ), sizeof( address ) ) != 0 ||
+			listen( listenSocket, SOMAXCONN ) != 0 )
+		{
+			CloseSocket( _ToHandle( listenSocket ) );
+			return INVALID_SOCKET_HANDLE;
+		}
+
+		return _ToHandle( listenSocket );
+	}
+
+	uint16_t GetLocalPort( const SocketHandle socket )
+	{
+		if ( socket == INVALID_SOCKET_HANDLE )
+			return 0;
+
+		sockaddr_in address;
+		SockLenType addressSize = sizeof( address );
+		if ( getsockname( _ToNative( socket ), reinterpret_cast< sockaddr* >( &address ), &addressSize ) != 0 )
+			return 0;
+
+		return ntohs( address.sin_port );
+	}
+
+	SocketHandle AcceptSocket( const SocketHandle listenSocket )
+	{
+		const NativeSocket acceptedSocket = accept( _ToNative( listenSocket ), nullptr, nullptr );
+		if ( _ToHandle( acceptedSocket ) != INVALID_SOCKET_HANDLE )
+			_SetNoDelay( acceptedSocket );
+
+		return _ToHandle( acceptedSocket );
+	}
+
+	SocketHandle ConnectLoopback( const uint16_t port )
+	{
+		_InitSocketLibrary();
+
+		const NativeSocket connectSocket = socket( AF_INET, SOCK_STREAM, IPPROTO_TCP );
+		if ( _ToHandle( connectSocket ) == INVALID_SOCKET_HANDLE )
+			return INVALID_SOCKET_HANDLE;
+
+		const sockaddr_in address = _MakeLoopbackAddress( port );
+		if ( connect( connectSocket, reinterpret_cast< const sockaddr* >( &address ), sizeof( address ) ) != 0 )
+		{
+			CloseSocket( _ToHandle( connectSocket ) );
+			return INVALID_SOCKET_HANDLE;
+		}
+
+		_SetNoDelay( connectSocket );
+		return _ToHandle( connectSocket );
+	}
+
+	bool SendAll( const SocketHandle socket, const char* buffer, std::size_t size )
+	{
+		while ( size > 0 )
+		{
+			const int sendSize = static_cast< int >( std::min< std::size_t >( size, 1024 * 1024 * 1024 ) );
+			const int sentSize = static_cast< int >( send( _ToNative( socket ), buffer, sendSize, SEND_FLAG ) );
+			if ( sentSize <= 0 )
+				return false;
+
+			buffer += sentSize;
+			size   -= sentSize;
+		}
+
+		return true;
+	}
+
+	int SendSome( const SocketHandle socket, const char* buffer, const std::size_t size )
+	{
+		const int sendSize = static_cast< int >( std::min< std::size_t >( size, 1024 * 1024 * 1024 ) );
+		const int sentSize = static_cast< int >( send( _ToNative( socket ), buffer, sendSize, SEND_FLAG ) );
+		if ( sentSize >= 0 )
+			return sentSize;
+
+		return _IsWouldBlock() ? 0 : -1;
+	}
+
+	int RecvSome( const SocketHandle socket, char* buffer, const std::size_t size )
+	{
+		const int recvSize = static_cast< int >( recv( _ToNative( socket ), buffer, static_cast< int >( size ), 0 ) );
+		if ( recvSize < 0 && _IsWouldBlock() )
+			return RECV_WOULD_BLOCK;
+
+		return recvSize;
+	}
+
+	bool CreateWakePair( SocketHandle& outRecvSocket, SocketHandle& outSendSocket )
+	{
+		// Windows WSAPoll Socket ٸ  ֱ , pipe  Loopback  Socket   Ѵ.
+		const SocketHandle listenSocket = ListenLoopback( 0 );
+		if ( listenSocket == INVALID_SOCKET_HANDLE )
+			return false;
+
+		outSendSocket = ConnectLoopback( GetLocalPort( listenSocket ) );
+		outRecvSocket = outSendSocket != INVALID_SOCKET_HANDLE ? AcceptSocket( listenSocket ) : INVALID_SOCKET_HANDLE;
+		CloseSocket( listenSocket );
+
+		if ( outRecvSocket == INVALID_SOCKET_HANDLE )
+		{
+			if ( outSendSocket != INVALID_SOCKET_HANDLE )
+				CloseSocket( outSendSocket );
+
+			outSendSocket = INVALID_SOCKET_HANDLE;
+			return false;
+		}
+
+		SetNonBlocking( outRecvSocket );
+		SetNonBlocking( outSendSocket );
+		return true;
+	}
+
+	void SetNonBlocking( const SocketHandle socket )
+	{
+#ifdef _WIN32
+		u_long isNonBlocking = 1;
+		ioctlsocket( _ToNative( socket ), FIONBIO, &isNonBlocking );
+#else
+		fcntl( _ToNative( socket ), F_SETFL, fcntl( _ToNative( socket ), F_GETFL, 0 ) | O_NONBLOCK );
+#endif
+	}
+
+	void WaitIo(
+		const std::vector< SocketHandle >& readSocketCont,
+		const std::vector< SocketHandle >& writeSocketCont,
+		const int                          timeoutMs,
+		std::vector< SocketHandle >&       outReadableCont,
+		std::vector< SocketHandle >&       outWritableCont )
+	{
+		outReadableCont.clear();
+		outWritableCont.clear();
+
+		//  Socket б  ο ִٸ, ϳ pollfd Բ ٸ.
+		std::vector< PollFdType > pollFds;
+		pollFds.reserve( readSocketCont.size() + writeSocketCont.size() );
+
+		for ( const auto socket : readSocketCont )
+			pollFds.push_back( PollFdType{ _ToNative( socket ), POLLIN, 0 } );
+
+		for ( const auto socket : writeSocketCont )
+		{
+			const auto pollFdIter = std::find_if( pollFds.begin(), pollFds.end(), [ & ]( const PollFdType& pollFd ) { return pollFd.fd == _ToNative( socket ); } );
+			if ( pollFdIter != pollFds.end() )
+				pollFdIter->events |= POLLOUT;
+			else
+				pollFds.push_back( PollFdType{ _ToNative( socket ), POLLOUT, 0 } );
+		}
+
+		if ( _Poll( pollFds.data(), pollFds.size(), timeoutMs ) <= 0 )
+			return;
+
+		// ų  ִ Socket б,   Ͽ, ̾ recv, send з óǵ Ѵ.
+		for ( const auto& pollFd : pollFds )
+		{
+			if ( !pollFd.revents )
+				continue;
+
+			const bool isBroken = pollFd.revents & ( POLLERR | POLLHUP | POLLNVAL );
+			if ( ( pollFd.events & POLLIN ) && ( ( pollFd.revents & POLLIN ) || isBroken ) )
+				outReadableCont.emplace_back( static_cast< SocketHandle >( pollFd.fd ) );
+
+			if ( ( pollFd.events & POLLOUT ) && ( ( pollFd.revents & POLLOUT ) || isBroken ) )
+				outWritableCont.emplace_back( static_cast< SocketHandle >( pollFd.fd ) );
+		}
+	}
+
+	void ShutdownSocket( const SocketHandle socket )
+	{
+#ifdef _WIN32
+		shutdown( _ToNative( socket ), SD_BOTH );
+#else
+		shutdown( _ToNative( socket ), SHUT_RDWR );
+#endif
+	}
+
+	void CloseSocket( const SocketHandle socket )
+	{
+#ifdef _WIN32
+		closesocket( _ToNative( socket ) );
+#else
+		close( _ToNative( socket ) );
+#endif
+	}
+}
+
+namespace WonSY::Concurrency
+{
+	void TestBroadcastReplication()
+	{
+		using namespace std::chrono_literals;
+		using _DataType = std::map< int, int >;
+
+		struct TestContextKey{};
+
+		// Op { , key, value },  0 , 1 ϱ. Snapshot { key, value } .
+		enum OP_TYPE : int { OP_ASSIGN, OP_ADD };
+
+		WsyReplicationCodec< _DataType > codec;
+		codec.m_serializeFunc = []( const _DataType& data, std::string& outBuffer )
+			{
+				outBuffer.reserve( outBuffer.size() + data.size() * sizeof( int ) * 2 );
+				for ( const auto& [ key, value ] : data )
+				{
+					outBuffer.append( reinterpret_cast< const char* >( &key   ), sizeof( key   ) );
+					outBuffer.append( reinterpret_cast< const char* >( &value ), sizeof( value ) );
+				}
+			};
+		codec.m_deserializeFunc = []( const char* buffer, const std::size_t size, _DataType& outData )
+			{
+				if ( size % ( sizeof( int ) * 2 ) )
+					return false;
+
+				for ( std::size_t offset = 0; offset < size; offset += sizeof( int ) * 2 )
+				{
+					int key, value;
+					std::memcpy( &key,   buffer + offset,                 sizeof( key   ) );
+					std::memcpy( &value, buffer + offset + sizeof( key ), sizeof( value ) );
+					outData.emplace_hint( outData.end(), key, value );
+				}
+
+				return true;
+			};
+		codec.m_applyOpFunc = []( _DataType& data, const char* opData, const std::size_t opSize )
+			{
+				int op[ 3 ];
+				if ( opSize != sizeof( op ) )
+					return false;
+
+				std::memcpy( op, opData, sizeof( op ) );
+				if ( op[ 0 ] == OP_ADD )
+					data[ op[ 1 ] ] += op[ 2 ];
+				else if ( op[ 0 ] == OP_ASSIGN )
+					data[ op[ 1 ] ] = op[ 2 ];
+				else
+					return false;
+
+				return true;
+			};
+
+		// Loopback ׽Ʈ
+		{
+			std::cout << "start! Replication ׽Ʈ " << std::endl;
+
+			TestContextKey testContextKey;
+
+			WsyBroadcastPtr< TestContextKey, _DataType >       broadCastPtr( nullptr );
+			WsyBroadcastPublisher< TestContextKey, _DataType > publisher   ( codec   );
+			publisher.Attach( testContextKey, broadCastPtr );
+
+			const auto insertFunc = [ & ]( const int key, const int value )
+				{
+					broadCastPtr.Set( testContextKey,
+						[ & ]( _DataType& data )
+						{
+							data[ key ] = value;
+
+							const int op[ 3 ] = { OP_ASSIGN, key, value };
+							publisher.AppendOp( testContextKey, reinterpret_cast< const char* >( op ), sizeof( op ) );
+							return true;
+						} );
+				};
+
+			// DOUBLING  Լ Slave , Op Master     ϵǾ Ѵ.
+			const auto addFunc = [ & ]( const int key, const int value, const BROADCAST_SYNC_TYPE syncType )
+				{
+					broadCastPtr.Set( testContextKey,
+						[ & ]( _DataType& data )
+						{
+							data[ key ] += value;
+
+							const int op[ 3 ] = { OP_ADD, key, value };
+							publisher.AppendOp( testContextKey, reinterpret_cast< const char* >( op ), sizeof( op ) );
+							return true;
+						}, syncType );
+				};
+
+			//   Subscriber ù Snapshot ޴´.
+			WsyBroadcastSubscriber< _DataType > earlySubscriber( codec, publisher.GetPort() );
+			while ( publisher.GetSubscriberCount() < 1 ) { std::this_thread::sleep_for( 1ms ); }
+
+			for ( int i = 0; i < 1000; ++i )
+				insertFunc( i, i );
+
+			// Op-Log  ü ٲٸ Snapshot ޵ȴ.
+			broadCastPtr.Set( testContextKey, _DataType{ { -1, -1 } } );
+
+			for ( int i = 0; i < 1000; ++i )
+				insertFunc( i, -i );
+
+			// ʰ  Subscriber  Snapshot +  Delta ´.
+			WsyBroadcastSubscriber< _DataType > lateSubscriber( codec, publisher.GetPort() );
+			while ( publisher.GetSubscriberCount() < 2 ) { std::this_thread::sleep_for( 1ms ); }
+
+			for ( int i = 1000; i < 1100; ++i )
+				insertFunc( i, i );
+
+			//   Op, ߺ ϵ ʾҴ ȮѴ.
+			for ( int i = 0; i < 100; ++i )
+			{
+				addFunc( 0,    1, BROADCAST_SYNC_TYPE::DOUBLING );
+				addFunc( 1, 1000, BROADCAST_SYNC_TYPE::ADAPTIVE );
+			}
+
+			//    Op , Replica Ϻθ  ¸ Publish ʰ  Snapshot ٸ.
+			broadCastPtr.Set( testContextKey,
+				[ & ]( _DataType& )
+				{
+					const int op[ 3 ] = { -1, 0, 0 };
+					publisher.AppendOp( testContextKey, reinterpret_cast< const char* >( op ), sizeof( op ) );
+					return true;
+				} );
+
+			const uint64_t invalidVersion = broadCastPtr.GetStat().m_publishCount;
+			std::this_thread::sleep_for( 200ms );
+
+			for ( auto* subscriber : { &earlySubscriber, &lateSubscriber } )
+			{
+				if ( subscriber->GetVersion() >= invalidVersion )
+					std::cout << "Replication !    Op Publish" << std::endl;
+			}
+
+			broadCastPtr.Set( testContextKey, _DataType( broadCastPtr.Get( testContextKey ) ) );
+
+			const uint64_t lastVersion = broadCastPtr.GetStat().m_publishCount;
+			const _DataType& masterData = broadCastPtr.Get( testContextKey );
+
+			for ( auto* subscriber : { &earlySubscriber, &lateSubscriber } )
+			{
+				if ( !subscriber->WaitForVersion( lastVersion, 5s ) || subscriber->GetReplica().GetCopy() != masterData )
+					std::cout << "Replication ! version : " << subscriber->GetVersion() << " / " << lastVersion << std::endl;
+			}
+
+			publisher.Detach( testContextKey, broadCastPtr );
+
+			const auto stat = publisher.GetStat();
+			std::cout << "Replication ׽Ʈ ! snapshot : " << stat.m_snapshotCount << ", delta : " << stat.m_deltaCount
+				<< ", resync : " << stat.m_resyncCount << ", sent : " << stat.m_sentBytes << " bytes" << std::endl;
+		}
+
+		// INCREMENTAL ׽Ʈ
+		{
+			std::cout << "start! Replication INCREMENTAL ׽Ʈ " << std::endl;
+
+			TestContextKey testContextKey;
+
+			WsyBroadcastPtr< TestContextKey, _DataType > broadCastPtr(
+				[]()
+				{
+					auto data = new _DataType();
+					for ( int k = 0; k < 1000; ++k )
+						data->insert( { k, k } );
+
+					return data;
+				} );
+
+			WsyBroadcastPublisher< TestContextKey, _DataType > publisher( codec );
+			publisher.Attach( testContextKey, broadCastPtr );
+			broadCastPtr.SetPublishType( testContextKey, BROADCAST_PUBLISH_TYPE::INCREMENTAL );
+
+			WsyBroadcastSubscriber< _DataType > subscriber( codec, publisher.GetPort() );
+			while ( publisher.GetSubscriberCount() < 1 ) { std::this_thread::sleep_for( 1ms ); }
+
+			const auto insertFunc = [ & ]( const int key, const int value )
+				{
+					broadCastPtr.Set( testContextKey,
+						[ & ]( _DataType& data )
+						{
+							data[ key ] = value;
+
+							const int op[ 3 ] = { OP_ASSIGN, key, value };
+							publisher.AppendOp( testContextKey, reinterpret_cast< const char* >( op ), sizeof( op ) );
+							return true;
+						} );
+				};
+
+			const auto checkFunc = [ & ]( const char* name )
+				{
+					broadCastPtr.Publish( testContextKey );
+
+					const uint64_t lastVersion = broadCastPtr.GetStat().m_publishCount;
+					if ( !subscriber.WaitForVersion( lastVersion, 5s ) || subscriber.GetReplica().GetCopy() != broadCastPtr.Get( testContextKey ) )
+						std::cout << "Replication INCREMENTAL ! " << name << ", size : " << subscriber.GetReplica().GetCopy().size() << " / " << broadCastPtr.Get( testContextKey ).size() << std::endl;
+				};
+
+			// ù Publish Snapshot,  Op ̷ Publish Delta .
+			insertFunc( 1, 1 );
+			checkFunc( "Snapshot" );
+
+			insertFunc( 2, 2 );
+			insertFunc( 3, 3 );
+			checkFunc( "Op-Log" );
+
+			//  Set ϳ Publish  , ߰ Op  ü ٲ Ⱑ ִٸ Snapshot  Ѵ.
+			insertFunc( 5, 5 );
+			broadCastPtr.Set( testContextKey, _DataType{ { 100, 100 } } );
+			insertFunc( 6, 6 );
+			checkFunc( "Set( data )" );
+
+			// Op   Set( func ) .
+			insertFunc( 7, 7 );
+			broadCastPtr.Set( testContextKey, []( _DataType& data ) { data[ 8 ] = 8; return true; } );
+			insertFunc( 9, 9 );
+			checkFunc( "Op  Set( func )" );
+
+			publisher.Detach( testContextKey, broadCastPtr );
+
+			const auto stat = publisher.GetStat();
+			std::cout << "Replication INCREMENTAL ׽Ʈ ! snapshot : " << stat.m_snapshotCount << ", delta : " << stat.m_deltaCount << std::endl;
+		}
+
+		//  Subscriber ׽Ʈ
+		{
+			std::cout << "start! Replication  Subscriber ׽Ʈ " << std::endl;
+
+			TestContextKey testContextKey;
+
+			WsyBroadcastPtr< TestContextKey, _DataType >       broadCastPtr( nullptr );
+			WsyBroadcastPublisher< TestContextKey, _DataType > publisher   ( codec, 0, 64 * 1024 * 1024, 300ms );
+			publisher.Attach( testContextKey, broadCastPtr );
+			broadCastPtr.SetPublishType( testContextKey, BROADCAST_PUBLISH_TYPE::LAZY );
+
+			// Ӹ ϰ  ʴ Subscriber ִ, ٸ Subscriber  ޾ƾ Ѵ.
+			const auto stuckSocket = Replication::ConnectLoopback( publisher.GetPort() );
+			WsyBroadcastSubscriber< _DataType > subscriber( codec, publisher.GetPort() );
+			while ( publisher.GetSubscriberCount() < 2 ) { std::this_thread::sleep_for( 1ms ); }
+
+			_DataType data;
+			for ( int k = 0; k < 100000; ++k )
+				data.insert( { k, k } );
+
+			// Snapshot  ,  ʴ Subscriber Socket Buffer  ä.
+			const auto startTime = std::chrono::high_resolution_clock::now();
+			for ( int i = 0; publisher.GetStat().m_disconnectCount == 0 && std::chrono::high_resolution_clock::now() - startTime < 10s; ++i )
+			{
+				data[ 0 ] = i;
+				broadCastPtr.Set( testContextKey, data );
+				std::this_thread::sleep_for( 10ms );
+			}
+
+			const uint64_t lastVersion = broadCastPtr.GetStat().m_publishCount;
+			if ( publisher.GetStat().m_disconnectCount == 0 )
+				std::cout << "Replication !  ʴ Subscriber   " << std::endl;
+
+			if ( !subscriber.WaitForVersion( lastVersion, 5s ) || subscriber.GetReplica().GetCopy() != broadCastPtr.Get( testContextKey ) )
+				std::cout << "Replication ! version : " << subscriber.GetVersion() << " / " << lastVersion << std::endl;
+
+			publisher.Detach( testContextKey, broadCastPtr );
+			Replication::CloseSocket( stuckSocket );
+
+			std::cout << "Replication  Subscriber ׽Ʈ ! disconnect : " << publisher.GetStat().m_disconnectCount << ", "
+				<< std::chrono::duration_cast< std::chrono::milliseconds >( std::chrono::high_resolution_clock::now() - startTime ).count() << " msecs" << std::endl;
+		}
+
+		// ó ׽Ʈ
+		{
+			const int elementCount = 10000;
+			const int loopCount    = 100000;
+
+			const auto chekFunc = [ & ]( const std::string& name, const bool isUseOpLog )
+			{
+				TestContextKey testContextKey;
+
+				WsyBroadcastPtr< TestContextKey, _DataType >       broadCastPtr( nullptr );
+				WsyBroadcastPublisher< TestContextKey, _DataType > publisher   ( codec   );
+				publisher.Attach( testContextKey, broadCastPtr );
+
+				//  Process Reader  , Slave    Replication 븸 Ѵ.
+				broadCastPtr.SetPublishType( testContextKey, BROADCAST_PUBLISH_TYPE::LAZY );
+
+				broadCastPtr.Set( testContextKey,
+					[ & ]( _DataType& data )
+					{
+						for ( int k = 0; k < elementCount; ++k )
+							data.insert( { k, k } );
+
+						return true;
+					} );
+
+				WsyBroadcastSubscriber< _DataType > subscriber( codec, publisher.GetPort() );
+				while ( publisher.GetSubscriberCount() < 1 ) { std::this_thread::sleep_for( 1ms ); }
+
+				const int  publishCount = isUseOpLog ? loopCount : loopCount / 100;
+				const auto startTime    = std::chrono::high_resolution_clock::now();
+
+				for ( int i = 0; i < publishCount; ++i )
+				{
+					broadCastPtr.Set( testContextKey,
+						[ & ]( _DataType& data )
+						{
+							const int op[ 3 ] = { OP_ASSIGN, i % elementCount, i };
+							data[ op[ 1 ] ] = op[ 2 ];
+
+							if ( isUseOpLog )
+								publisher.AppendOp( testContextKey, reinterpret_cast< const char* >( op ), sizeof( op ) );
+
+							return true;
+						} );
+				}
+
+				const bool isReached = subscriber.WaitForVersion( broadCastPtr.GetStat().m_publishCount, 30s );
+				const auto elapsedMs = std::max< long long >( 1, std::chrono::duration_cast< std::chrono::milliseconds >( std::chrono::high_resolution_clock::now() - startTime ).count() );
+
+				publisher.Detach( testContextKey, broadCastPtr );
+
+				const auto stat = publisher.GetStat();
+				std::cout << name << " : " << elapsedMs << " msecs, " << ( publishCount * 1000LL / elapsedMs ) << " versions/sec, "
+					<< ( stat.m_sentBytes / 1024 / elapsedMs ) << " MB/sec"
+					<< ", snapshot : " << stat.m_snapshotCount << ", delta : " << stat.m_deltaCount
+					<< ( isReached ? "" : " (  ! )" ) << std::endl;
+			};
+
+			chekFunc( "Replication - Op-Log", true  );
+			chekFunc( "Replication - Snapshot", false );
+		}
+	}
+}
@@ -0,0 +1,702 @@
+/*
+	Copyright 2021, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+#include "WonSY_BroadcastPtr.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+
+namespace WonSY::Concurrency
+{
+#pragma region [ BroadcastReplication ]
+	// #0. BroadcastPtr Publish , ش Version Op-Log Delta Ȥ Full Snapshot Loopback TCP Socket  ٸ Process Replica Ѵ.
+	// !0. ⺻ Ʒ     Ѵ.
+	//	 - 0. Op-Log Master Context Set Լ ȿ,  Master ͸   AppendOp Ѵ. Op-Log  Ⱑ  Publish Snapshot ޵ȴ.
+	//	      INCREMENTALó  Set ϳ Publish ,   ϳ Op  ʾҴٸ( Set( data )  )  Op-Log  Snapshot .
+	//	      DOUBLING   Լ Slave ٽ   AppendOp õǱ , ϱó   Op   ϵȴ.
+	//	 - 1.  Architecture( Endian, Type ũ ) Process   Ѵ.
+	//	 - 2.  Delta  Snapshot Ŀ Snapshot ٽ ,  Subscriber и Subscriber  Snapshot +  Delta ٽ .
+	//	 - 3.  IO Thread ϳ Non-Blocking óϸ, sendTimeout     Subscriber  ´.
+
+	namespace Replication
+	{
+		// SOCKET( Windows ), int( POSIX ) θ   ִ ũ
+		using SocketHandle = std::intptr_t;
+		constexpr SocketHandle INVALID_SOCKET_HANDLE = -1;
+
+		enum class FRAME_TYPE : uint8_t
+		{
+			SNAPSHOT,  // = Payload ȭ ü 
+			DELTA,     // = Payload [ uint32 ũ ][ Op ] . BaseVersion Ϳ  Ѵ.
+		};
+
+		struct FrameHeader
+		{
+			uint64_t   m_payloadSize = 0;  // = ȭ Snapshot 4GB   ֱ  64bit д.
+			FRAME_TYPE m_frameType   = FRAME_TYPE::SNAPSHOT;
+			uint64_t   m_version     = 0;
+			uint64_t   m_baseVersion = 0;
+		};
+
+		constexpr std::size_t FRAME_HEADER_SIZE = sizeof( uint64_t ) + sizeof( uint8_t ) + sizeof( uint64_t ) + sizeof( uint64_t );
+		constexpr char        RESYNC_REQUEST    = 'R';
+		constexpr int         RECV_WOULD_BLOCK  = -2;
+
+		void AppendFrame( std::string& outBuffer, const FrameHeader& frameHeader, const char* payload );
+		void ReadFrameHeader( const char* buffer, FrameHeader& outFrameHeader );
+		void AppendOpRecord( std::string& outBuffer, const char* opData, std::size_t opSize );
+		bool ForEachOpRecord( const char* payload, std::size_t payloadSize, const std::function< bool( const char*, std::size_t ) >& func );
+
+		NODISCARD SocketHandle ListenLoopback( uint16_t port );
+		NODISCARD uint16_t     GetLocalPort( SocketHandle socket );
+		NODISCARD SocketHandle AcceptSocket( SocketHandle listenSocket );
+		NODISCARD SocketHandle ConnectLoopback( uint16_t port );
+		NODISCARD bool         SendAll( SocketHandle socket, const char* buffer, std::size_t size );
+		NODISCARD int          SendSome( SocketHandle socket, const char* buffer, std::size_t size );  // = Non-Blocking Socket.  ũ,    ٸ 0,   -1
+		NODISCARD int          RecvSome( SocketHandle socket, char* buffer, std::size_t size );        // = Non-Blocking Socket    ٸ RECV_WOULD_BLOCK
+		NODISCARD bool         CreateWakePair( SocketHandle& outRecvSocket, SocketHandle& outSendSocket );
+		void                   SetNonBlocking( SocketHandle socket );
+		void                   WaitIo( const std::vector< SocketHandle >& readSocketCont, const std::vector< SocketHandle >& writeSocketCont, int timeoutMs, std::vector< SocketHandle >& outReadableCont, std::vector< SocketHandle >& outWritableCont );
+		void                   ShutdownSocket( SocketHandle socket );
+		void                   CloseSocket( SocketHandle socket );
+	}
+
+	template < class _DataType >
+	struct ReplicationCodec
+	{
+		std::function< void( const _DataType&, std::string& ) >       m_serializeFunc;    // = ü ͸ ڿ ٿ ȭ
+		std::function< bool( const char*, std::size_t, _DataType& ) > m_deserializeFunc;  // = ȭ ü ͸ 
+		std::function< bool( _DataType&, const char*, std::size_t ) > m_applyOpFunc;      // = AppendOp ϵ Op ϳ 
+	};
+
+	struct ReplicationStat
+	{
+		uint64_t m_snapshotCount   = 0;  // = Snapshot  Publish Ƚ
+		uint64_t m_deltaCount      = 0;  // = Delta  Publish Ƚ
+		uint64_t m_resyncCount     = 0;  // = Subscriber Snapshot + Delta ٽ  Ƚ ( ű   )
+		uint64_t m_sentBytes       = 0;
+		uint64_t m_disconnectCount = 0;  // =  sendTimeout   ʾ   Subscriber 
+	};
+
+	template < class _ContextKeyType, class _DataType >
+	class BroadcastPublisher
+	{
+#pragma region [ Def ]
+		static constexpr int IO_WAIT_TIMEOUT_MS = 100;  // = IO Thread ִ  ð.   Subscriber Ȯϴ ֱⰡ ȴ.
+
+		struct Subscriber
+		{
+			Replication::SocketHandle             m_socket;
+			std::string                           m_pendingBuffer;     // =     Frame.  Version   .
+			std::string                           m_sendingBuffer;     // =  ִ Frame. IO Thread 
+			std::size_t                           m_sentSize;          // = m_sendingBuffer   ũ
+			std::chrono::steady_clock::time_point m_lastProgressTime;  // =   Ǿų,    ð
+			bool                                  m_isClosed;
+		};
+#pragma endregion
+
+#pragma region [ Public Func ]
+	public:
+		BroadcastPublisher(
+			const ReplicationCodec< _DataType >& codec,
+			const uint16_t                       port            = 0,
+			const std::size_t                    maxPendingBytes = 64 * 1024 * 1024,
+			const std::chrono::milliseconds      sendTimeout     = std::chrono::milliseconds( 5000 ) )
+			: m_codec          ( codec                                  )
+			, m_maxPendingBytes( maxPendingBytes                        )
+			, m_sendTimeout    ( sendTimeout                            )
+			, m_listenSocket   ( Replication::ListenLoopback( port )    )
+			, m_wakeRecvSocket ( Replication::INVALID_SOCKET_HANDLE     )
+			, m_wakeSendSocket ( Replication::INVALID_SOCKET_HANDLE     )
+			, m_isWakePending  ( false                                  )
+			, m_logWriteFunc   (                                        )
+			, m_opLog          (                                        )
+			, m_opCount        ( 0                                      )
+			, m_lastVersion    ( 0                                      )
+			, m_lock           (                                        )
+			, m_snapshotFrame  (                                        )
+			, m_catchUpFrames  (                                        )
+			, m_subscriberCont (                                        )
+			, m_stat           (                                        )
+			, m_isStop         ( false                                  )
+			, m_ioThread       (                                        )
+		{
+			// IO Thread Socket ٸ ȿ, Publish Ḧ Wake Socket  ٷ   ִ.
+			if ( m_listenSocket != Replication::INVALID_SOCKET_HANDLE && Replication::CreateWakePair( m_wakeRecvSocket, m_wakeSendSocket ) )
+			{
+				Replication::SetNonBlocking( m_listenSocket );
+				m_ioThread = std::thread( [ this ]() { _RunIo(); } );
+			}
+		}
+
+		~BroadcastPublisher()
+		{
+			{
+				std::lock_guard local( m_lock );
+				m_isStop = true;
+			}
+
+			//   Non-Blocking̱ ,  ʴ Subscriber ִ IO Thread ٷ .
+			_WakeIo();
+			if ( m_ioThread.joinable() )
+				m_ioThread.join();
+
+			for ( auto& subscriber : m_subscriberCont )
+				Replication::CloseSocket( subscriber->m_socket );
+
+			for ( const auto socket : { m_listenSocket, m_wakeRecvSocket, m_wakeSendSocket } )
+			{
+				if ( socket != Replication::INVALID_SOCKET_HANDLE )
+					Replication::CloseSocket( socket );
+			}
+		}
+
+		// BroadcastPtr Publish  Publisher ȣǵ Ѵ. BroadcastPtr  Master Context ȣؾ Ѵ.
+		template < class _BroadcastPtrType >
+		void Attach( const _ContextKeyType& contextKey, _BroadcastPtrType& broadcastPtr )
+		{
+			m_logWriteFunc = [ &broadcastPtr, contextKey ]() { return broadcastPtr.MarkWriteLogged( contextKey ); };
+
+			broadcastPtr.SetPublishListener( contextKey,
+				[ this ]( const _DataType& data, const uint64_t version, const bool hasUnloggedWrite )
+				{
+					_OnPublish( data, version, hasUnloggedWrite );
+				} );
+		}
+
+		// Publisher BroadcastPtr  ҸѴٸ,   Master Context   Ѵ.
+		template < class _BroadcastPtrType >
+		void Detach( const _ContextKeyType& contextKey, _BroadcastPtrType& broadcastPtr )
+		{
+			broadcastPtr.SetPublishListener( contextKey, nullptr );
+			m_logWriteFunc = nullptr;
+		}
+
+		// Master Context Set Լ ȿ, Master ͸  Op Ѵ. ̹ Publish Delta ȴ.
+		void AppendOp( const _ContextKeyType&, const char* opData, const std::size_t opSize )
+		{
+			//  ʾҰų,  Լ Master ƴ Slave Ǵ ̶  ʴ´.
+			if ( !m_logWriteFunc || !m_logWriteFunc() )
+				return;
+
+			Replication::AppendOpRecord( m_opLog, opData, opSize );
+			++m_opCount;
+		}
+
+		NODISCARD uint16_t GetPort() const
+		{
+			return Replication::GetLocalPort( m_listenSocket );
+		}
+
+		NODISCARD std::size_t GetSubscriberCount()
+		{
+			std::lock_guard local( m_lock );
+			return m_subscriberCont.size();
+		}
+
+		NODISCARD ReplicationStat GetStat()
+		{
+			std::lock_guard local( m_lock );
+			return m_stat;
+		}
+
+#pragma endregion
+
+#pragma region [ Private Func ]
+	private:
+		// Master Context
+		void _OnPublish( const _DataType& data, const uint64_t version, const bool hasUnloggedWrite )
+		{
+			std::string frame;
+
+			// ̹ Publish  Ⱑ Op-Log ϵǾ,  Snapshot   Delta ũⰡ Snapshot   Delta .
+			// Op  Ⱑ ٸ,  Op-Logδ ̹ Version   .
+			// m_snapshotFrame, m_catchUpFrames Master Context Ǳ ,   Lock ʿ .
+			const bool isDelta =
+				!hasUnloggedWrite &&
+				m_opCount > 0 &&
+				!m_snapshotFrame.empty() &&
+				m_catchUpFrames.size() + m_opLog.size() + Replication::FRAME_HEADER_SIZE < m_snapshotFrame.size();
+
+			if ( isDelta )
+			{
+				Replication::FrameHeader frameHeader;
+				frameHeader.m_payloadSize = m_opLog.size();
+				frameHeader.m_frameType   = Replication::FRAME_TYPE::DELTA;
+				frameHeader.m_version     = version;
+				frameHeader.m_baseVersion = m_lastVersion;
+				Replication::AppendFrame( frame, frameHeader, m_opLog.data() );
+			}
+			else
+			{
+				std::string payload;
+				m_codec.m_serializeFunc( data, payload );
+
+				Replication::FrameHeader frameHeader;
+				frameHeader.m_payloadSize = payload.size();
+				frameHeader.m_frameType   = Replication::FRAME_TYPE::SNAPSHOT;
+				frameHeader.m_version     = version;
+				Replication::AppendFrame( frame, frameHeader, payload.data() );
+			}
+
+			m_opLog.clear();
+			m_opCount     = 0;
+			m_lastVersion = version;
+
+			{
+				std::lock_guard local( m_lock );
+
+				if ( isDelta )
+				{
+					m_catchUpFrames += frame;
+					++m_stat.m_deltaCount;
+
+					for ( auto& subscriber : m_subscriberCont )
+					{
+						//  и Subscriber,  Frame  Snapshot +  Delta ٽ .
+						if ( subscriber->m_pendingBuffer.size() + frame.size() > m_maxPendingBytes )
+							_ResetPendingBuffer( *subscriber );
+						else
+							subscriber->m_pendingBuffer += frame;
+					}
+				}
+				else
+				{
+					m_snapshotFrame = std::move( frame );
+					m_catchUpFrames.clear();
+					++m_stat.m_snapshotCount;
+
+					// Snapshot  Frame  üϱ ,    Frame .
+					for ( auto& subscriber : m_subscriberCont )
+						subscriber->m_pendingBuffer = m_snapshotFrame;
+				}
+			}
+
+			_WakeIo();
+		}
+
+		// m_lock  ä ȣ
+		void _ResetPendingBuffer( Subscriber& subscriber )
+		{
+			subscriber.m_pendingBuffer = m_snapshotFrame + m_catchUpFrames;
+			++m_stat.m_resyncCount;
+		}
+
+		// IO Thread Publish Ḧ ˸.  IO Thread   ˸ ִٸ, ٽ  ʴ´.
+		void _WakeIo()
+		{
+			if ( m_wakeSendSocket == Replication::INVALID_SOCKET_HANDLE || m_isWakePending.exchange( true, std::memory_order_acq_rel ) )
+				return;
+
+			const char wakeSignal = 0;
+			static_cast< void >( Replication::SendSome( m_wakeSendSocket, &wakeSignal, sizeof( wakeSignal ) ) );
+		}
+
+		// IO Thread.  , Resync û ,  Frame  óѴ.  Socket Non-Blocking̸, аų     Ѵ.
+		void _RunIo()
+		{
+			std::vector< Replication::SocketHandle > readSocketCont;
+			std::vector< Replication::SocketHandle > writeSocketCont;
+			std::vector< Replication::SocketHandle > readableSocketCont;
+			std::vector< Replication::SocketHandle > writableSocketCont;
+			char                                     recvBuffer[ 256 ];
+
+			while ( true )
+			{
+				readSocketCont = { m_listenSocket, m_wakeRecvSocket };
+				writeSocketCont.clear();
+				{
+					std::lock_guard local( m_lock );
+					if ( m_isStop )
+						return;
+
+					//   ִ Subscriber   θ ٸ.
+					for ( const auto& subscriber : m_subscriberCont )
+					{
+						readSocketCont.emplace_back( subscriber->m_socket );
+						if ( !subscriber->m_sendingBuffer.empty() || !subscriber->m_pendingBuffer.empty() )
+							writeSocketCont.emplace_back( subscriber->m_socket );
+					}
+				}
+
+				Replication::WaitIo( readSocketCont, writeSocketCont, IO_WAIT_TIMEOUT_MS, readableSocketCont, writableSocketCont );
+
+				for ( const auto readableSocket : readableSocketCont )
+				{
+					if ( readableSocket == m_wakeRecvSocket )
+					{
+						//  ˸   Ŀ  ˸ ޴´.  ̿  ˸ Frame, ̹ ݺ   ٽ   δ.
+						while ( Replication::RecvSome( m_wakeRecvSocket, recvBuffer, sizeof( recvBuffer ) ) > 0 ) {}
+						m_isWakePending.store( false, std::memory_order_release );
+						continue;
+					}
+
+					if ( readableSocket == m_listenSocket )
+					{
+						const auto acceptedSocket = Replication::AcceptSocket( m_listenSocket );
+						if ( acceptedSocket == Replication::INVALID_SOCKET_HANDLE )
+							continue;
+
+						Replication::SetNonBlocking( acceptedSocket );
+
+						std::lock_guard local( m_lock );
+						auto& subscriber = m_subscriberCont.emplace_back( new Subscriber{ acceptedSocket, std::string(), std::string(), 0, std::chrono::steady_clock::now(), false } );
+						_ResetPendingBuffer( *subscriber );
+						continue;
+					}
+
+					const int recvSize = Replication::RecvSome( readableSocket, recvBuffer, sizeof( recvBuffer ) );
+					if ( recvSize == Replication::RECV_WOULD_BLOCK )
+						continue;
+
+					std::lock_guard local( m_lock );
+					for ( auto& subscriber : m_subscriberCont )
+					{
+						if ( subscriber->m_socket != readableSocket )
+							continue;
+
+						if ( recvSize <= 0 )
+							subscriber->m_isClosed = true;
+						else if ( std::find( recvBuffer, recvBuffer + recvSize, Replication::RESYNC_REQUEST ) != recvBuffer + recvSize )
+							_ResetPendingBuffer( *subscriber );
+					}
+				}
+
+				// m_subscriberCont IO Thread ߰, Ǳ , IO Thread Lock  ȸ  ִ.
+				for ( auto& subscriber : m_subscriberCont )
+				{
+					if ( std::find( writableSocketCont.begin(), writableSocketCont.end(), subscriber->m_socket ) != writableSocketCont.end() )
+						_SendPending( *subscriber );
+				}
+
+				{
+					std::lock_guard local( m_lock );
+
+					const auto nowTime = std::chrono::steady_clock::now();
+					for ( auto iter = m_subscriberCont.begin(); iter != m_subscriberCont.end(); )
+					{
+						Subscriber& subscriber = **iter;
+
+						//  ʴ Subscriber ϳ  ٸ Subscriber ۰ Publisher ᰡ  ʵ,   ٸ  ´.
+						if ( subscriber.m_sendingBuffer.empty() && subscriber.m_pendingBuffer.empty() )
+						{
+							subscriber.m_lastProgressTime = nowTime;
+						}
+						else if ( !subscriber.m_isClosed && nowTime - subscriber.m_lastProgressTime > m_sendTimeout )
+						{
+							subscriber.m_isClosed = true;
+							++m_stat.m_disconnectCount;
+						}
+
+						if ( subscriber.m_isClosed )
+						{
+							Replication::CloseSocket( subscriber.m_socket );
+							iter = m_subscriberCont.erase( iter );
+						}
+						else
+						{
+							++iter;
+						}
+					}
+				}
+			}
+		}
+
+		// IO Thread.  Frame Socket ޾ִ ŭ .
+		void _SendPending( Subscriber& subscriber )
+		{
+			while ( !subscriber.m_isClosed )
+			{
+				if ( subscriber.m_sendingBuffer.empty() )
+				{
+					//  Version Frame    .
+					std::lock_guard local( m_lock );
+					std::swap( subscriber.m_sendingBuffer, subscriber.m_pendingBuffer );
+					subscriber.m_sentSize = 0;
+					m_stat.m_sentBytes += subscriber.m_sendingBuffer.size();
+
+					if ( subscriber.m_sendingBuffer.empty() )
+						return;
+				}
+
+				const int sentSize = Replication::SendSome( subscriber.m_socket, subscriber.m_sendingBuffer.data() + subscriber.m_sentSize, subscriber.m_sendingBuffer.size() - subscriber.m_sentSize );
+				if ( sentSize < 0 )
+				{
+					std::lock_guard local( m_lock );
+					subscriber.m_isClosed = true;
+					return;
+				}
+
+				// Socket Buffer  áٸ,      ̾ .
+				if ( sentSize == 0 )
+					return;
+
+				subscriber.m_sentSize        += sentSize;
+				subscriber.m_lastProgressTime = std::chrono::steady_clock::now();
+
+				if ( subscriber.m_sentSize == subscriber.m_sendingBuffer.size() )
+				{
+					subscriber.m_sendingBuffer.clear();
+					subscriber.m_sentSize = 0;
+				}
+			}
+		}
+
+#pragma endregion
+
+#pragma region [ Member Var ]
+	private:
+		const ReplicationCodec< _DataType >          m_codec;
+		const std::size_t                            m_maxPendingBytes;
+		const std::chrono::milliseconds              m_sendTimeout;
+		const Replication::SocketHandle              m_listenSocket;
+		Replication::SocketHandle                    m_wakeRecvSocket;  // = IO Thread   Loopback Socket  
+		Replication::SocketHandle                    m_wakeSendSocket;
+		std::atomic< bool >                          m_isWakePending;   // =  ˸ IO Thread   ʾҴ
+
+		std::function< bool() >                      m_logWriteFunc;    // =  BroadcastPtr ̹ Ⱑ ϵǾ ǥ. Լ Master Ϳ Ǵ  ƴ϶ false. Master Context 
+		std::string                                  m_opLog;           // = Master Context 
+		std::size_t                                  m_opCount;         // = Master Context 
+		uint64_t                                     m_lastVersion;     // = Master Context 
+
+		std::mutex                                   m_lock;
+		std::string                                  m_snapshotFrame;  // =  Snapshot Frame
+		std::string                                  m_catchUpFrames;  // =  Snapshot  Delta Frame
+		std::vector< std::unique_ptr< Subscriber > > m_subscriberCont;
+		ReplicationStat                              m_stat;
+		bool                                         m_isStop;
+
+		std::thread                                  m_ioThread;
+#pragma endregion
+	};
+
+	template < class _DataType >
+	class BroadcastSubscriber
+	{
+#pragma region [ Def ]
+		//  Thread Replica Master Context ȴ.
+		struct ReplicaContextKey {};
+
+	public:
+		using ReplicaType = BroadcastPtr< ReplicaContextKey, _DataType >;
+#pragma endregion
+
+#pragma region [ Public Func ]
+	public:
+		BroadcastSubscriber( const ReplicationCodec< _DataType >& codec, const uint16_t port )
+			: m_codec        ( codec                                 )
+			, m_socket       ( Replication::ConnectLoopback( port )  )
+			, m_replica      ( nullptr                               )
+			, m_version      ( 0                                     )
+			, m_isSynced     ( false                                 )
+			, m_failedVersion( 0                                     )
+			, m_isConnected  ( m_socket != Replication::INVALID_SOCKET_HANDLE )
+			, m_lock         (                                       )
+			, m_condition    (                                       )
+			, m_recvThread   (                                       )
+		{
+			if ( m_isConnected )
+				m_recvThread = std::thread( [ this ]() { _RunRecv(); } );
+		}
+
+		~BroadcastSubscriber()
+		{
+			if ( m_socket != Replication::INVALID_SOCKET_HANDLE )
+				Replication::ShutdownSocket( m_socket );
+
+			if ( m_recvThread.joinable() )
+				m_recvThread.join();
+
+			if ( m_socket != Replication::INVALID_SOCKET_HANDLE )
+				Replication::CloseSocket( m_socket );
+		}
+
+		// Reader Replica GetCopy, RunReadOnlyTask  д´.
+		NODISCARD ReplicaType& GetReplica()
+		{
+			return m_replica;
+		}
+
+		NODISCARD uint64_t GetVersion() const
+		{
+			return m_version.load( std::memory_order_acquire );
+		}
+
+		NODISCARD bool IsConnected() const
+		{
+			return m_isConnected.load( std::memory_order_acquire );
+		}
+
+		// Replica ش Version ̻   Ѵ.
+		bool WaitForVersion( const uint64_t version, const std::chrono::milliseconds timeout )
+		{
+			std::unique_lock local( m_lock );
+			return m_condition.wait_for( local, timeout, [ & ]() { return GetVersion() >= version || !IsConnected(); } ) && GetVersion() >= version;
+		}
+
+#pragma endregion
+
+#pragma region [ Private Func ]
+	private:
+		void _RunRecv()
+		{
+			ReplicaContextKey contextKey;
+
+			std::string recvBuffer;
+			std::size_t readOffset = 0;
+			std::vector< char > chunk( 64 * 1024 );
+
+			while ( true )
+			{
+				const int recvSize = Replication::RecvSome( m_socket, chunk.data(), chunk.size() );
+				if ( recvSize <= 0 )
+					break;
+
+				recvBuffer.append( chunk.data(), recvSize );
+
+				//     Version , Replica   PublishѴ.
+				std::unique_ptr< _DataType >                                    snapshot;
+				std::vector< std::tuple< const char*, std::size_t, uint64_t > > deltaCont;  // = [ Payload, Payload ũ, Version ]
+				uint64_t                                                        version = m_version.load( std::memory_order_relaxed );
+
+				while ( recvBuffer.size() - readOffset >= Replication::FRAME_HEADER_SIZE )
+				{
+					Replication::FrameHeader frameHeader;
+					Replication::ReadFrameHeader( recvBuffer.data() + readOffset, frameHeader );
+					if ( recvBuffer.size() - readOffset < Replication::FRAME_HEADER_SIZE + frameHeader.m_payloadSize )
+						break;
+
+					const char* payload = recvBuffer.data() + readOffset + Replication::FRAME_HEADER_SIZE;
+					readOffset += Replication::FRAME_HEADER_SIZE + frameHeader.m_payloadSize;
+
+					if ( frameHeader.m_frameType == Replication::FRAME_TYPE::SNAPSHOT )
+					{
+						snapshot = std::make_unique< _DataType >();
+						deltaCont.clear();
+
+						m_isSynced = m_codec.m_deserializeFunc( payload, frameHeader.m_payloadSize, *snapshot );
+						if ( m_isSynced )
+						{
+							version = frameHeader.m_version;
+						}
+						else
+						{
+							snapshot.reset();
+							_RequestResync();
+						}
+					}
+					else if ( m_isSynced && frameHeader.m_baseVersion == version )
+					{
+						deltaCont.emplace_back( payload, frameHeader.m_payloadSize, frameHeader.m_version );
+						version = frameHeader.m_version;
+					}
+					else if ( m_isSynced )
+					{
+						// Version ߳ٸ,  Snapshot   Delta Ѵ.
+						m_isSynced = false;
+						_RequestResync();
+					}
+				}
+
+				if ( snapshot || !deltaCont.empty() )
+				{
+					const bool isApplied = m_replica.Set( contextKey,
+						[ & ]( _DataType& data )
+						{
+							if ( snapshot )
+								data = std::move( *snapshot );
+
+							for ( const auto& [ payload, payloadSize, deltaVersion ] : deltaCont )
+							{
+								if ( !Replication::ForEachOpRecord( payload, payloadSize, [ & ]( const char* opData, const std::size_t opSize ) { return m_codec.m_applyOpFunc( data, opData, opSize ); } ) )
+								{
+									// 뿡 ߴٸ, Ϻθ  Replica Master Publish ʰ,  Snapshot ü ٽ .
+									//  Delta ̹ Resync ûߴٸ, ٽ ûص  Delta ٽ  ̱ ,  Snapshot ٸ.
+									m_isSynced = false;
+									if ( m_failedVersion != deltaVersion )
+									{
+										m_failedVersion = deltaVersion;
+										_RequestResync();
+									}
+
+									return false;
+								}
+							}
+
+							return true;
+						} );
+
+					// Publish ʾҴٸ, Reader  Slave Version  ״δ.
+					if ( isApplied )
+					{
+						{
+							std::lock_guard local( m_lock );
+							m_version.store( version, std::memory_order_release );
+						}
+
+						m_condition.notify_all();
+					}
+				}
+
+				// ó Frame տ ߶󳽴.
+				recvBuffer.erase( 0, readOffset );
+				readOffset = 0;
+			}
+
+			{
+				std::lock_guard local( m_lock );
+				m_isConnected.store( false, std::memory_order_release );
+			}
+
+			m_condition.notify_all();
+		}
+
+		void _RequestResync()
+		{
+			const char request = Replication::RESYNC_REQUEST;
+			if ( !Replication::SendAll( m_socket, &request, sizeof( request ) ) )
+				Replication::ShutdownSocket( m_socket );
+		}
+
+#pragma endregion
+
+#pragma region [ Member Var ]
+	private:
+		const ReplicationCodec< _DataType > m_codec;
+		const Replication::SocketHandle     m_socket;
+
+		ReplicaType                         m_replica;
+		std::atomic< uint64_t >             m_version;        // = Replica ݿ Publisher Version
+		bool                                m_isSynced;       // =  Thread 
+		uint64_t                            m_failedVersion;  // = 뿡   Delta Version.  Thread 
+		std::atomic< bool >                 m_isConnected;
+
+		std::mutex                          m_lock;
+		std::condition_variable             m_condition;
+
+		std::thread                         m_recvThread;
+#pragma endregion
+	};
+
+	void TestBroadcastReplication();
+
+#pragma endregion
+}
+
+template < class _ContextKey, class _DataType >
+using WsyBroadcastPublisher = WonSY::Concurrency::BroadcastPublisher< _ContextKey, _DataType >;
+
+template < class _DataType >
+using WsyBroadcastSubscriber = WonSY::Concurrency::BroadcastSubscriber< _DataType >;
+
+template < class _DataType >
+using WsyReplicationCodec = WonSY::Concurrency::ReplicationCodec< _DataType >;
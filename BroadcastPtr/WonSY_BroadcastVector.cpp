@@ -0,0 +1,191 @@
+/*
+	Copyright 2021, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#include "WonSY_BroadcastVector.h"
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace WonSY::Concurrency
+{
+	void TestBroadcastVector()
+	{
+		using namespace std::chrono_literals;
+
+		struct TestContextKey{};
+
+		// Ἲ ׽Ʈ
+		{
+			std::cout << "start! BroadcastVector Ἲ ׽Ʈ " << std::endl;
+
+			WsyBroadcastVector< TestContextKey, std::string > broadcastVector;
+			const int loopCount       = 100000;
+			const int readThreadCount = 3;
+
+			std::atomic< bool > isWriteEnd = false;
+			std::thread writeThread = static_cast< std::thread >( [ & ]()
+				{
+					TestContextKey testContextKey;
+
+					for ( int i = 0; i < loopCount; ++i )
+					{
+						// ׻ index ==  ǵ ߰Ѵ.
+						broadcastVector.EmplaceBack( testContextKey, std::to_string( broadcastVector.GetSize( testContextKey ) ) );
+
+						// д  Reader ִ, Truncate Compact Reader  Ŀ ҿ ޸𸮸 Ѵ.
+						if ( i % 20000 == 19999 )
+						{
+							broadcastVector.Truncate( testContextKey, broadcastVector.GetSize( testContextKey ) / 3 );
+							broadcastVector.Compact( testContextKey );
+						}
+					}
+
+					isWriteEnd = true;
+				} );
+
+			std::vector< std::thread > readThreadCont;
+			for ( int i = 0; i < readThreadCount; ++i )
+			{
+				readThreadCont.emplace_back(
+					static_cast< std::thread >(
+						[ & ]()
+						{
+							while ( !isWriteEnd )
+							{
+								broadcastVector.RunReadOnlyTask(
+									[]( const auto& view )
+									{
+										std::size_t index = 0;
+										view.ForEach(
+											[ & ]( const std::string& value )
+											{
+												if ( value != std::to_string( index++ ) )
+													std::cout << "BroadcastVector Ἲ ! index : " << index - 1 << std::endl;
+											} );
+									} );
+							}
+						} ) );
+			}
+
+			writeThread.join();
+			for ( auto& th : readThreadCont ) { th.join(); }
+
+			std::cout << "BroadcastVector Ἲ ׽Ʈ ! size : " << broadcastVector.GetPublishedSize() << std::endl;
+		}
+
+		//  ׽Ʈ
+		{
+			WsyBroadcastVector< TestContextKey, int > broadcastVector;
+			broadcastVector.PushBack( TestContextKey(), 1 );
+
+			// Reader func ܸ  Reader  Ǯ,  Truncate Reader ٸ  ʴ´.
+			try
+			{
+				broadcastVector.RunReadOnlyTask( []( const auto& ) { throw std::runtime_error( "reader" ); } );
+			}
+			catch ( const std::exception& )
+			{
+			}
+
+			broadcastVector.Truncate( TestContextKey(), 0 );
+			std::cout << "BroadcastVector  ׽Ʈ ! size : " << broadcastVector.GetPublishedSize() << std::endl;
+		}
+
+		//  ׽Ʈ
+		{
+			const int loopCount       = 20000;
+			const int readThreadCount = 3;
+			const int readCount       = 2000;
+
+			const auto chekFunc = [ & ]( const std::string& name, const auto& writeFunc, const auto& readFunc )
+			{
+				const auto startTime = std::chrono::high_resolution_clock::now();
+
+				std::cout << "start! " << name << std::endl;
+
+				// Writer Reader   .
+				long long writeMs = 0;
+				std::thread writeThread = static_cast< std::thread >( [ & ]()
+					{
+						for ( int i = 0; i < loopCount; ++i )
+							writeFunc( i );
+
+						writeMs = std::chrono::duration_cast< std::chrono::milliseconds >( std::chrono::high_resolution_clock::now() - startTime ).count();
+					} );
+
+				std::vector< std::thread > readThreadCont;
+				for ( int i = 0; i < readThreadCount; ++i )
+				{
+					readThreadCont.emplace_back(
+						static_cast< std::thread >(
+							[ & ]()
+							{
+								long long sumValue = 0;
+								for ( int i = 0; i < readCount; ++i )
+									sumValue += readFunc();
+							} ) );
+				}
+
+				writeThread.join();
+				for ( auto& th : readThreadCont ) { th.join(); }
+
+				std::cout << "end! " << name << " : " << std::chrono::duration_cast< std::chrono::milliseconds >( std::chrono::high_resolution_clock::now() - startTime ).count() << " msecs"
+					<< ", write : " << writeMs << " msecs\n";
+			};
+
+			const auto sumFunc = []( const auto& data )
+			{
+				long long tempValue = 0;
+				for ( const int value : data ) { tempValue += value; }
+				return tempValue;
+			};
+
+			for ( const auto syncType : { BROADCAST_SYNC_TYPE::COPY, BROADCAST_SYNC_TYPE::DOUBLING } )
+			{
+				WsyBroadcastPtr< TestContextKey, std::vector< int > > broadCastPtr( nullptr );
+
+				chekFunc( syncType == BROADCAST_SYNC_TYPE::COPY ? "BroadcastPtr< vector > - Copy" : "BroadcastPtr< vector > - DOUBLING",
+					[ & ]( const int value )
+					{
+						broadCastPtr.Set( TestContextKey(), [ & ]( std::vector< int >& data ) { data.emplace_back( value ); return true; }, syncType );
+					},
+					[ & ]()
+					{
+						long long tempValue = 0;
+						broadCastPtr.RunReadOnlyTask( [ & ]( const std::vector< int >& data ) { tempValue = sumFunc( data ); } );
+						return tempValue;
+					} );
+			}
+
+			{
+				WsyBroadcastVector< TestContextKey, int > broadcastVector;
+
+				chekFunc( "BroadcastVector",
+					[ & ]( const int value )
+					{
+						broadcastVector.PushBack( TestContextKey(), value );
+					},
+					[ & ]()
+					{
+						long long tempValue = 0;
+						broadcastVector.RunReadOnlyTask(
+							[ & ]( const auto& view )
+							{
+								// ӵ ޸  ȸϸ, std::vector   ȸ ȴ.
+								view.ForEachSegment(
+									[ & ]( const int* segment, const std::size_t count )
+									{
+										for ( std::size_t i = 0; i < count; ++i ) { tempValue += segment[ i ]; }
+									} );
+							} );
+						return tempValue;
+					} );
+			}
+		}
+	}
+}
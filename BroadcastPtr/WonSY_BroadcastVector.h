@@ -0,0 +1,306 @@
+/*
+	Copyright 2021, Won Seong-Yeon. All Rights Reserved.
+		KoreaGameMaker@gmail.com
+		github.com/GameForPeople
+*/
+
+#pragma once
+
+#include "WonSY_BroadcastPtr.h"
+
+#include <bit>
+#include <memory>
+#include <thread>
+
+namespace WonSY::Concurrency
+{
+#pragma region [ BroadcastVector ]
+	// #0. Event Log,  Entity ó ڿ ߰ ϴ Ϳ , BroadcastPtró  Set ü  ʰ, Reader Publish պκ Lock   ȸϵ ϴ  ǥ 
+	// !0. ⺻ Ʒ     Ѵ.
+	//	 - 0. Single Context Write( Master Context ) - Multi Context Read( Slave Context ), BroadcastPtr  Context Key 
+	//	 - 1. Ҵ ũⰡ 2辿 Ŀ Segment Ǹ,   ߰ Ҵ ̵ ʴ´. ߰ Ŀ Publish ũ⸦ Release Ѵ.
+	//	 - 2. ̹ Publish Ҵ  ʴ´. ̰ų( Truncate ) ޸𸮸 ȯϴ( Compact ) , а ִ Reader   ڿ óȴ.
+
+	template < class _ContextKeyType, class _Type >
+	class BroadcastVector
+	{
+#pragma region [ Def ]
+		static constexpr std::size_t FIRST_SEGMENT_BIT  = 6;
+		static constexpr std::size_t FIRST_SEGMENT_SIZE = std::size_t( 1 ) << FIRST_SEGMENT_BIT;  // = k° Segment ũ FIRST_SEGMENT_SIZE << k
+		static constexpr std::size_t SEGMENT_COUNT      = sizeof( std::size_t ) * 8 - FIRST_SEGMENT_BIT;
+
+	public:
+		// Reader ޵Ǵ, Publish պκп  б  View. RunReadOnlyTask ȿ ȿϴ.
+		class ReadOnlyView
+		{
+		public:
+			ReadOnlyView( const BroadcastVector& owner, const std::size_t size )
+				: m_owner( owner )
+				, m_size ( size  )
+			{
+			}
+
+			NODISCARD std::size_t size()  const { return m_size;      }
+			NODISCARD bool        empty() const { return m_size == 0; }
+
+			NODISCARD const _Type& operator[]( const std::size_t index ) const
+			{
+				return m_owner._At( index );
+			}
+
+			// Segment , ӵ ޸(  ּ,  )  Ѵ.
+			template < class _FuncType >
+			void ForEachSegment( _FuncType&& func ) const
+			{
+				for ( std::size_t segmentIndex = 0, segmentBegin = 0; segmentBegin < m_size; segmentBegin = _GetSegmentBegin( ++segmentIndex ) )
+				{
+					const std::size_t segmentEnd = std::min( m_size, _GetSegmentBegin( segmentIndex + 1 ) );
+					func( m_owner.m_segmentTable[ segmentIndex ].load( std::memory_order_relaxed ), segmentEnd - segmentBegin );
+				}
+			}
+
+			template < class _FuncType >
+			void ForEach( _FuncType&& func ) const
+			{
+				ForEachSegment(
+					[ & ]( const _Type* segment, const std::size_t count )
+					{
+						for ( const _Type* iter = segment; iter != segment + count; ++iter )
+							func( *iter );
+					} );
+			}
+
+		private:
+			const BroadcastVector& m_owner;
+			const std::size_t      m_size;
+		};
+
+	private:
+		// func ܸ  Reader  Ǯ, _EnterRead _LeaveRead ´. BroadcastPtr shared_lock  .
+		class ReadGuard
+		{
+		public:
+			explicit ReadGuard( const BroadcastVector& owner )
+				: m_owner( owner              )
+				, m_epoch( owner._EnterRead() )
+			{
+			}
+
+			~ReadGuard()
+			{
+				m_owner._LeaveRead( m_epoch );
+			}
+
+			ReadGuard( const ReadGuard& )            = delete;
+			ReadGuard& operator=( const ReadGuard& ) = delete;
+
+		private:
+			const BroadcastVector& m_owner;
+			const uint64_t         m_epoch;
+		};
+#pragma endregion
+
+#pragma region [ Public Func ]
+	public:
+		BroadcastVector()
+			: m_segmentTable (   )
+			, m_size         ( 0 )
+			, m_publishedSize( 0 )
+			, m_epoch        ( 0 )
+			, m_readerCount  {   }
+		{
+		}
+
+		~BroadcastVector()
+		{
+			// unsafe
+			_DestroyElements( 0, m_size );
+			_FreeSegments( 0 );
+		}
+
+		BroadcastVector( const BroadcastVector& )            = delete;
+		BroadcastVector& operator=( const BroadcastVector& ) = delete;
+
+		// Master Context Lock  ٷ д´.
+		NODISCARD const _Type& Get( const _ContextKeyType&, const std::size_t index ) const
+		{
+			return _At( index );
+		}
+
+		NODISCARD std::size_t GetSize( const _ContextKeyType& ) const
+		{
+			return m_size;
+		}
+
+		//  Context,  Publish ũ⸦ ȯѴ.
+		NODISCARD std::size_t GetPublishedSize() const
+		{
+			return m_publishedSize.load( std::memory_order_acquire );
+		}
+
+		template < class... _ArgTypes >
+		void EmplaceBack( const _ContextKeyType&, _ArgTypes&&... args )
+		{
+			_Emplace( std::forward< _ArgTypes >( args )... );
+			_Publish();
+		}
+
+		void PushBack( const _ContextKeyType& contextKey, const _Type& value )
+		{
+			EmplaceBack( contextKey, value );
+		}
+
+		//  Ҹ ߰ ,   PublishѴ.
+		template < class _IterType >
+		void Append( const _ContextKeyType&, _IterType first, const _IterType last )
+		{
+			for ( ; first != last; ++first )
+				_Emplace( *first );
+
+			_Publish();
+		}
+
+		// Reader Lock , Task   Publish պκ   д´.
+		void RunReadOnlyTask( const std::function< void( const ReadOnlyView& ) >& func ) const
+		{
+			const ReadGuard readGuard( *this );
+			func( ReadOnlyView( *this, m_publishedSize.load( std::memory_order_acquire ) ) );
+		}
+
+		// newSize  ҵ Ѵ.   ũ⸦  Reader     Ŀ ҸŲ.
+		void Truncate( const _ContextKeyType&, const std::size_t newSize )
+		{
+			if ( newSize >= m_size )
+				return;
+
+			m_publishedSize.store( newSize, std::memory_order_seq_cst );
+			_WaitForReaders();
+
+			_DestroyElements( newSize, m_size );
+			m_size = newSize;
+		}
+
+		void Clear( const _ContextKeyType& contextKey )
+		{
+			Truncate( contextKey, 0 );
+		}
+
+		// Truncate Ŀ  ̻  ʴ Segment ޸𸮸 ȯѴ.
+		void Compact( const _ContextKeyType& )
+		{
+			_WaitForReaders();
+			_FreeSegments( m_size ? _GetSegmentIndex( m_size - 1 ) + 1 : 0 );
+		}
+
+#pragma endregion
+
+#pragma region [ Private Func ]
+	private:
+		static constexpr std::size_t _GetSegmentIndex( const std::size_t index )
+		{
+			return std::bit_width( index + FIRST_SEGMENT_SIZE ) - 1 - FIRST_SEGMENT_BIT;
+		}
+
+		static constexpr std::size_t _GetSegmentBegin( const std::size_t segmentIndex )
+		{
+			return ( FIRST_SEGMENT_SIZE << segmentIndex ) - FIRST_SEGMENT_SIZE;
+		}
+
+		NODISCARD const _Type& _At( const std::size_t index ) const
+		{
+			const std::size_t segmentIndex = _GetSegmentIndex( index );
+			return m_segmentTable[ segmentIndex ].load( std::memory_order_relaxed )[ index - _GetSegmentBegin( segmentIndex ) ];
+		}
+
+		// Master Context.  Publish  ڸ Ҹ Ѵ.
+		template < class... _ArgTypes >
+		void _Emplace( _ArgTypes&&... args )
+		{
+			const std::size_t segmentIndex = _GetSegmentIndex( m_size );
+
+			_Type* segment = m_segmentTable[ segmentIndex ].load( std::memory_order_relaxed );
+			if ( !segment )
+			{
+				segment = std::allocator< _Type >().allocate( FIRST_SEGMENT_SIZE << segmentIndex );
+				m_segmentTable[ segmentIndex ].store( segment, std::memory_order_relaxed );
+			}
+
+			new ( segment + ( m_size - _GetSegmentBegin( segmentIndex ) ) ) _Type( std::forward< _ArgTypes >( args )... );
+			++m_size;
+		}
+
+		// Master Context.  ҿ Segment Reader ̵ Release Ѵ.
+		void _Publish()
+		{
+			m_publishedSize.store( m_size, std::memory_order_release );
+		}
+
+		uint64_t _EnterRead() const
+		{
+			while ( true )
+			{
+				const uint64_t epoch = m_epoch.load( std::memory_order_seq_cst );
+				m_readerCount[ epoch & 1 ].fetch_add( 1, std::memory_order_seq_cst );
+
+				// ϴ ̿ Epoch ٲٸ, Writer  Reader ٸ   ֱ  ٽ Ѵ.
+				if ( m_epoch.load( std::memory_order_seq_cst ) == epoch )
+					return epoch;
+
+				m_readerCount[ epoch & 1 ].fetch_sub( 1, std::memory_order_release );
+			}
+		}
+
+		void _LeaveRead( const uint64_t epoch ) const
+		{
+			m_readerCount[ epoch & 1 ].fetch_sub( 1, std::memory_order_release );
+		}
+
+		// Master Context. Epoch ѱ ,  Epoch  Reader    Ѵ.
+		void _WaitForReaders()
+		{
+			const uint64_t oldEpoch = m_epoch.load( std::memory_order_relaxed );
+			m_epoch.store( oldEpoch + 1, std::memory_order_seq_cst );
+
+			// Epoch  Reader  Ȯ, _EnterRead ϰ Epoch Ȯο  ϳ   ϱ  seq_cst д´.
+			while ( m_readerCount[ oldEpoch & 1 ].load( std::memory_order_seq_cst ) != 0 )
+				std::this_thread::yield();
+		}
+
+		void _DestroyElements( const std::size_t beginIndex, const std::size_t endIndex )
+		{
+			if constexpr ( !std::is_trivially_destructible_v< _Type > )
+			{
+				for ( std::size_t index = beginIndex; index < endIndex; ++index )
+					const_cast< _Type& >( _At( index ) ).~_Type();
+			}
+		}
+
+		void _FreeSegments( const std::size_t beginSegmentIndex )
+		{
+			for ( std::size_t segmentIndex = beginSegmentIndex; segmentIndex < SEGMENT_COUNT; ++segmentIndex )
+			{
+				if ( _Type* segment = m_segmentTable[ segmentIndex ].exchange( nullptr, std::memory_order_relaxed ) )
+					std::allocator< _Type >().deallocate( segment, FIRST_SEGMENT_SIZE << segmentIndex );
+			}
+		}
+
+#pragma endregion
+
+#pragma region [ Member Var ]
+	private:
+		std::atomic< _Type* >           m_segmentTable[ SEGMENT_COUNT ];  // =  ũ ̵ , Segment  ̵ ʴ´.
+		std::size_t                     m_size;                           // = Master Context 
+		std::atomic< std::size_t >      m_publishedSize;
+
+		std::atomic< uint64_t >         m_epoch;
+		mutable std::atomic< uint64_t > m_readerCount[ 2 ];               // = Epoch Ȧ¦ а ִ Reader 
+#pragma endregion
+	};
+
+	void TestBroadcastVector();
+
+#pragma endregion
+}
+
+template < class _ContextKey, class _Type >
+using WsyBroadcastVector = WonSY::Concurrency::BroadcastVector< _ContextKey, _Type >;
@@ -1,6 +1,10 @@
 #include "WonSY_BroadcastPtr.h"
+#include "WonSY_BroadcastReplication.h"
+#include "WonSY_BroadcastVector.h"
 
 int main()
 {
 	WonSY::Concurrency::TestBroadcastPtr();
+	WonSY::Concurrency::TestBroadcastReplication();
+	WonSY::Concurrency::TestBroadcastVector();
 }
\ No newline at end of file